@@ -0,0 +1,250 @@
+#include "BenchmarkComparison.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "../../TerrainGenerator/src/engine/utility/FrameTimeReport.h"
+
+[[nodiscard]] double BenchmarkComparison::CalculateWelchPValue(const std::vector<double>& baselineSamples, const std::vector<double>& currentSamples)
+{
+	if (baselineSamples.size() < 2u || currentSamples.size() < 2u)
+	{
+		return 1.0;
+	}
+
+	const auto getMeanAndVariance = [](const std::vector<double>& samples) -> std::pair<double, double>
+	{
+		const double sampleCount = static_cast<double>(samples.size());
+		const double mean = std::accumulate(std::cbegin(samples), std::cend(samples), 0.0) / sampleCount;
+
+		double squaredDeviationSum = 0.0;
+
+		for (const double sample : samples)
+		{
+			squaredDeviationSum += (sample - mean) * (sample - mean);
+		}
+
+		return { mean, squaredDeviationSum / (sampleCount - 1.0) };
+	};
+
+	const auto [baselineMean, baselineVariance] = getMeanAndVariance(baselineSamples);
+	const auto [currentMean, currentVariance] = getMeanAndVariance(currentSamples);
+
+	const double baselineStandardErrorSquared = baselineVariance / static_cast<double>(baselineSamples.size());
+	const double currentStandardErrorSquared = currentVariance / static_cast<double>(currentSamples.size());
+	const double standardErrorSquared = baselineStandardErrorSquared + currentStandardErrorSquared;
+
+	if (standardErrorSquared <= 0.0)
+	{
+		return baselineMean == currentMean ? 1.0 : 0.0;
+	}
+
+	const double t = (currentMean - baselineMean) / std::sqrt(standardErrorSquared);
+	const double degreesOfFreedom = standardErrorSquared * standardErrorSquared
+		/ (baselineStandardErrorSquared * baselineStandardErrorSquared / static_cast<double>(baselineSamples.size() - 1u)
+			+ currentStandardErrorSquared * currentStandardErrorSquared / static_cast<double>(currentSamples.size() - 1u));
+
+	// Two-sided p-value of Student's t distribution, expressed through the regularised incomplete beta function.
+	return CalculateRegularisedIncompleteBeta(degreesOfFreedom / 2.0, 0.5, degreesOfFreedom / (degreesOfFreedom + t * t));
+}
+
+BenchmarkComparison::BenchmarkComparison(const JSONValue& baselineDocument, const JSONValue& currentDocument, const Config& config)
+	: m_config(config)
+{
+	if (baselineDocument.Contains("results") && currentDocument.Contains("results"))
+	{
+		CompareStageReports(BenchmarkReport::ReadJSON(baselineDocument), BenchmarkReport::ReadJSON(currentDocument));
+	}
+	else if (baselineDocument.Contains("frame_times_ms") && currentDocument.Contains("frame_times_ms"))
+	{
+		CompareFrameTimeReports(baselineDocument, currentDocument);
+	}
+	else
+	{
+		throw std::runtime_error("Baseline and current reports must both be stage benchmark reports or both be frame time reports.");
+	}
+}
+
+void BenchmarkComparison::Print(std::ostream& outputStream) const
+{
+	outputStream << std::left << std::setw(48) << "Benchmark" << std::right
+		<< std::setw(14) << "Baseline"
+		<< std::setw(14) << "Current"
+		<< std::setw(10) << "Change"
+		<< std::setw(12) << "p-value"
+		<< "  Verdict\n";
+
+	for (const auto& entry : m_entries)
+	{
+		outputStream << std::left << std::setw(48) << entry.name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(11) << entry.baselineValue << std::setw(3) << entry.unit
+			<< std::setw(11) << entry.currentValue << std::setw(3) << entry.unit
+			<< std::setw(9) << std::setprecision(1) << std::showpos << entry.relativeChange * 100.0 << std::noshowpos << "%"
+			<< std::setw(12) << std::setprecision(4) << entry.pValue
+			<< "  " << GetVerdictName(entry.verdict) << "\n";
+	}
+
+	outputStream << "\nThreshold: " << std::setprecision(1) << m_config.regressionThreshold * 100.0 << "%, significance level: " << std::setprecision(3) << m_config.significanceLevel << "\n";
+}
+
+[[nodiscard]] bool BenchmarkComparison::HasRegressions() const noexcept
+{
+	return std::any_of(std::cbegin(m_entries), std::cend(m_entries), [](const Entry& entry) { return entry.verdict == Verdict::Regressed; });
+}
+
+[[nodiscard]] double BenchmarkComparison::CalculateRegularisedIncompleteBeta(const double a, const double b, const double x)
+{
+	if (x <= 0.0)
+	{
+		return 0.0;
+	}
+
+	if (x >= 1.0)
+	{
+		return 1.0;
+	}
+
+	const double logFrontFactor = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1.0 - x);
+	const double frontFactor = std::exp(logFrontFactor);
+
+	if (x < (a + 1.0) / (a + b + 2.0))
+	{
+		return frontFactor * CalculateBetaContinuedFraction(a, b, x) / a;
+	}
+
+	return 1.0 - frontFactor * CalculateBetaContinuedFraction(b, a, 1.0 - x) / b;
+}
+
+[[nodiscard]] double BenchmarkComparison::CalculateBetaContinuedFraction(const double a, const double b, const double x)
+{
+	constexpr int MaxIterations = 300;
+	constexpr double Epsilon = 1.0e-12;
+	constexpr double MinDenominator = std::numeric_limits<double>::min() / Epsilon;
+
+	const auto clampDenominator = [](const double value) { return std::abs(value) < MinDenominator ? MinDenominator : value; };
+
+	double c = 1.0;
+	double d = 1.0 / clampDenominator(1.0 - (a + b) * x / (a + 1.0));
+	double fraction = d;
+
+	for (int m = 1; m <= MaxIterations; ++m)
+	{
+		const double evenCoefficient = m * (b - m) * x / ((a + 2.0 * m - 1.0) * (a + 2.0 * m));
+		d = 1.0 / clampDenominator(1.0 + evenCoefficient * d);
+		c = clampDenominator(1.0 + evenCoefficient / c);
+		fraction *= d * c;
+
+		const double oddCoefficient = -(a + m) * (a + b + m) * x / ((a + 2.0 * m) * (a + 2.0 * m + 1.0));
+		d = 1.0 / clampDenominator(1.0 + oddCoefficient * d);
+		c = clampDenominator(1.0 + oddCoefficient / c);
+
+		const double delta = d * c;
+		fraction *= delta;
+
+		if (std::abs(delta - 1.0) < Epsilon)
+		{
+			break;
+		}
+	}
+
+	return fraction;
+}
+
+[[nodiscard]] const char* BenchmarkComparison::GetVerdictName(const Verdict verdict) noexcept
+{
+	switch (verdict)
+	{
+	case Verdict::Improved:
+		return "improved";
+
+	case Verdict::Regressed:
+		return "REGRESSED";
+
+	case Verdict::Missing:
+		return "missing";
+
+	case Verdict::Added:
+		return "added";
+
+	case Verdict::Unchanged:
+	default:
+		return "unchanged";
+	}
+}
+
+void BenchmarkComparison::CompareStageReports(const BenchmarkReport& baselineReport, const BenchmarkReport& currentReport)
+{
+	std::unordered_map<std::string, const BenchmarkReport::Result*> currentResults;
+
+	for (const auto& result : currentReport.GetResults())
+	{
+		currentResults.insert({ BenchmarkReport::GetResultName(result), &result });
+	}
+
+	for (const auto& baselineResult : baselineReport.GetResults())
+	{
+		const std::string name = BenchmarkReport::GetResultName(baselineResult);
+		const auto currentResultLocation = currentResults.find(name);
+
+		if (currentResultLocation == std::cend(currentResults))
+		{
+			m_entries.push_back(Entry{ name, "us", baselineResult.median, 0.0, 0.0, 1.0, Verdict::Missing });
+
+			continue;
+		}
+
+		const BenchmarkReport::Result& currentResult = *currentResultLocation->second;
+		AddEntry(name, "us", baselineResult.median, currentResult.median, baselineResult.samples, currentResult.samples);
+
+		currentResults.erase(currentResultLocation);
+	}
+
+	for (const auto& currentResult : currentReport.GetResults())
+	{
+		if (const std::string name = BenchmarkReport::GetResultName(currentResult); currentResults.contains(name))
+		{
+			m_entries.push_back(Entry{ name, "us", 0.0, currentResult.median, 0.0, 1.0, Verdict::Added });
+		}
+	}
+}
+
+void BenchmarkComparison::CompareFrameTimeReports(const JSONValue& baselineDocument, const JSONValue& currentDocument)
+{
+	const FrameTimeReport baselineReport(baselineDocument["frame_times_ms"].AsNumberArray());
+	const FrameTimeReport currentReport(currentDocument["frame_times_ms"].AsNumberArray());
+
+	const std::string namePrefix = baselineDocument.Contains("name") ? "Frame time (" + baselineDocument["name"].AsString() + ") " : "Frame time ";
+
+	// Every percentile shares the frame time samples, so a percentile only counts as regressed when the whole distribution has shifted significantly.
+	AddEntry(namePrefix + "mean", "ms", baselineReport.GetMeanTime(), currentReport.GetMeanTime(), baselineReport.GetFrameTimes(), currentReport.GetFrameTimes());
+	AddEntry(namePrefix + "p50", "ms", baselineReport.GetP50Time(), currentReport.GetP50Time(), baselineReport.GetFrameTimes(), currentReport.GetFrameTimes());
+	AddEntry(namePrefix + "p95", "ms", baselineReport.GetP95Time(), currentReport.GetP95Time(), baselineReport.GetFrameTimes(), currentReport.GetFrameTimes());
+	AddEntry(namePrefix + "p99", "ms", baselineReport.GetP99Time(), currentReport.GetP99Time(), baselineReport.GetFrameTimes(), currentReport.GetFrameTimes());
+}
+
+void BenchmarkComparison::AddEntry(const std::string& name, const std::string& unit, const double baselineValue, const double currentValue, const std::vector<double>& baselineSamples, const std::vector<double>& currentSamples)
+{
+	Entry entry{ name, unit, baselineValue, currentValue };
+	entry.relativeChange = baselineValue > 0.0 ? (currentValue - baselineValue) / baselineValue : 0.0;
+	entry.pValue = CalculateWelchPValue(baselineSamples, currentSamples);
+
+	if (entry.pValue < m_config.significanceLevel)
+	{
+		if (entry.relativeChange > m_config.regressionThreshold)
+		{
+			entry.verdict = Verdict::Regressed;
+		}
+		else if (entry.relativeChange < -m_config.regressionThreshold)
+		{
+			entry.verdict = Verdict::Improved;
+		}
+	}
+
+	m_entries.push_back(entry);
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkReport.h"
+#include "JSONValue.h"
+
+class BenchmarkComparison
+{
+public:
+	struct Config
+	{
+		double regressionThreshold = 0.05;
+		double significanceLevel = 0.01;
+	};
+
+	enum class Verdict
+	{
+		Unchanged,
+		Improved,
+		Regressed,
+		Missing,
+		Added
+	};
+
+	struct Entry
+	{
+		std::string name;
+		std::string unit;
+
+		double baselineValue = 0.0;
+		double currentValue = 0.0;
+		double relativeChange = 0.0;
+		double pValue = 1.0;
+
+		Verdict verdict = Verdict::Unchanged;
+	};
+
+private:
+	Config m_config;
+	std::vector<Entry> m_entries;
+
+public:
+	[[nodiscard]] static double CalculateWelchPValue(const std::vector<double>& baselineSamples, const std::vector<double>& currentSamples);
+
+	BenchmarkComparison(const JSONValue& baselineDocument, const JSONValue& currentDocument, const Config& config);
+	~BenchmarkComparison() noexcept = default;
+
+	void Print(std::ostream& outputStream) const;
+	[[nodiscard]] bool HasRegressions() const noexcept;
+
+	inline const std::vector<Entry>& GetEntries() const noexcept { return m_entries; }
+
+private:
+	[[nodiscard]] static double CalculateRegularisedIncompleteBeta(const double a, const double b, const double x);
+	[[nodiscard]] static double CalculateBetaContinuedFraction(const double a, const double b, const double x);
+	[[nodiscard]] static const char* GetVerdictName(const Verdict verdict) noexcept;
+
+	void CompareStageReports(const BenchmarkReport& baselineReport, const BenchmarkReport& currentReport);
+	void CompareFrameTimeReports(const JSONValue& baselineDocument, const JSONValue& currentDocument);
+
+	void AddEntry(const std::string& name, const std::string& unit, const double baselineValue, const double currentValue, const std::vector<double>& baselineSamples, const std::vector<double>& currentSamples);
+};
\ No newline at end of file
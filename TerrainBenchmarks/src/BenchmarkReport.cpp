@@ -0,0 +1,193 @@
+#include "BenchmarkReport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "JSONValue.h"
+
+[[nodiscard]] std::string BenchmarkReport::GetResultName(const Result& result)
+{
+	return result.stage + " (" + std::to_string(result.chunkSize) + "x" + std::to_string(result.chunkSize) + ", " + std::to_string(result.octaveCount) + " octaves)";
+}
+
+[[nodiscard]] double BenchmarkReport::GetMillisecondsPerThousandChunks(const Result& result) noexcept
+{
+	constexpr double ChunksPerThousand = 1'000.0;
+	constexpr double MicrosecondsPerMillisecond = 1'000.0;
+
+	return result.median * ChunksPerThousand / MicrosecondsPerMillisecond;
+}
+
+[[nodiscard]] BenchmarkReport BenchmarkReport::ReadJSON(const JSONValue& document)
+{
+	BenchmarkReport report;
+
+	if (document.Contains("device"))
+	{
+		report.SetDeviceName(document["device"].AsString());
+	}
+
+	for (const auto& result : document["results"].AsArray())
+	{
+		report.AddResult(
+			result["stage"].AsString(),
+			static_cast<std::uint32_t>(result["chunk_size"].AsNumber()),
+			static_cast<std::uint32_t>(result["octave_count"].AsNumber()),
+			static_cast<std::size_t>(result["chunks_per_repetition"].AsNumber()),
+			result["samples_us_per_chunk"].AsNumberArray()
+		);
+	}
+
+	return report;
+}
+
+void BenchmarkReport::AddResult(const std::string& stage, const std::uint32_t chunkSize, const std::uint32_t octaveCount, const std::size_t chunksPerRepetition, std::vector<double> samplesMicroseconds)
+{
+	if (samplesMicroseconds.empty())
+	{
+		throw std::invalid_argument("Benchmark result " + stage + " has no samples.");
+	}
+
+	Result result{ stage, chunkSize, octaveCount, chunksPerRepetition, std::move(samplesMicroseconds) };
+	const double sampleCount = static_cast<double>(result.samples.size());
+
+	result.median = GetMedian(result.samples);
+	result.mean = std::accumulate(std::cbegin(result.samples), std::cend(result.samples), 0.0) / sampleCount;
+	result.min = *std::min_element(std::cbegin(result.samples), std::cend(result.samples));
+	result.max = *std::max_element(std::cbegin(result.samples), std::cend(result.samples));
+
+	std::vector<double> absoluteDeviations;
+	absoluteDeviations.reserve(result.samples.size());
+	double squaredDeviationSum = 0.0;
+
+	for (const double sample : result.samples)
+	{
+		absoluteDeviations.push_back(std::abs(sample - result.median));
+		squaredDeviationSum += (sample - result.mean) * (sample - result.mean);
+	}
+
+	result.medianAbsoluteDeviation = GetMedian(std::move(absoluteDeviations));
+	result.standardDeviation = result.samples.size() > 1u ? std::sqrt(squaredDeviationSum / (sampleCount - 1.0)) : 0.0;
+
+	m_results.push_back(std::move(result));
+}
+
+void BenchmarkReport::Print(std::ostream& outputStream) const
+{
+	if (!m_deviceName.empty())
+	{
+		outputStream << "Device: " << m_deviceName << "\n\n";
+	}
+
+	outputStream << std::left << std::setw(48) << "Stage" << std::right
+		<< std::setw(14) << "Median us"
+		<< std::setw(14) << "MAD us"
+		<< std::setw(14) << "Min us"
+		<< std::setw(16) << "ms/1000 chunks" << "\n";
+
+	for (const auto& result : m_results)
+	{
+		outputStream << std::left << std::setw(48) << GetResultName(result) << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(14) << result.median
+			<< std::setw(14) << result.medianAbsoluteDeviation
+			<< std::setw(14) << result.min
+			<< std::setw(16) << GetMillisecondsPerThousandChunks(result) << "\n";
+	}
+}
+
+void BenchmarkReport::WriteJSON(const std::string& filepath) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open benchmark report file " + filepath + " for writing.");
+	}
+
+	file.precision(6);
+	file << std::fixed;
+
+	file << "{\n"
+		<< "\t\"device\": \"" << EscapeJSONString(m_deviceName) << "\",\n"
+		<< "\t\"results\": [";
+
+	for (std::size_t i = 0; i < m_results.size(); ++i)
+	{
+		const Result& result = m_results[i];
+
+		file << (i == 0 ? "\n" : ",\n")
+			<< "\t\t{\n"
+			<< "\t\t\t\"name\": \"" << EscapeJSONString(GetResultName(result)) << "\",\n"
+			<< "\t\t\t\"stage\": \"" << EscapeJSONString(result.stage) << "\",\n"
+			<< "\t\t\t\"chunk_size\": " << result.chunkSize << ",\n"
+			<< "\t\t\t\"octave_count\": " << result.octaveCount << ",\n"
+			<< "\t\t\t\"chunks_per_repetition\": " << result.chunksPerRepetition << ",\n"
+			<< "\t\t\t\"median_us_per_chunk\": " << result.median << ",\n"
+			<< "\t\t\t\"mad_us_per_chunk\": " << result.medianAbsoluteDeviation << ",\n"
+			<< "\t\t\t\"mean_us_per_chunk\": " << result.mean << ",\n"
+			<< "\t\t\t\"stddev_us_per_chunk\": " << result.standardDeviation << ",\n"
+			<< "\t\t\t\"min_us_per_chunk\": " << result.min << ",\n"
+			<< "\t\t\t\"max_us_per_chunk\": " << result.max << ",\n"
+			<< "\t\t\t\"median_ms_per_thousand_chunks\": " << GetMillisecondsPerThousandChunks(result) << ",\n"
+			<< "\t\t\t\"samples_us_per_chunk\": [";
+
+		for (std::size_t j = 0; j < result.samples.size(); ++j)
+		{
+			file << (j == 0 ? "" : ", ") << result.samples[j];
+		}
+
+		file << "]\n\t\t}";
+	}
+
+	file << "\n\t]\n}\n";
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write benchmark report file " + filepath + ".");
+	}
+}
+
+[[nodiscard]] std::string BenchmarkReport::EscapeJSONString(const std::string& value)
+{
+	std::string escapedValue;
+	escapedValue.reserve(value.length());
+
+	for (const char character : value)
+	{
+		if (character == '"' || character == '\\')
+		{
+			escapedValue.push_back('\\');
+		}
+
+		escapedValue.push_back(character);
+	}
+
+	return escapedValue;
+}
+
+[[nodiscard]] double BenchmarkReport::GetMedian(std::vector<double> values)
+{
+	if (values.empty())
+	{
+		return 0.0;
+	}
+
+	const std::size_t middleIndex = values.size() / 2u;
+	std::nth_element(std::begin(values), std::begin(values) + middleIndex, std::end(values));
+
+	const double upperMedian = values[middleIndex];
+
+	if (values.size() % 2u == 1u)
+	{
+		return upperMedian;
+	}
+
+	const double lowerMedian = *std::max_element(std::cbegin(values), std::cbegin(values) + middleIndex);
+
+	return (lowerMedian + upperMedian) / 2.0;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class BenchmarkReport
+{
+public:
+	struct Result
+	{
+		std::string stage;
+		std::uint32_t chunkSize = 0u;
+		std::uint32_t octaveCount = 0u;
+		std::size_t chunksPerRepetition = 0u;
+
+		std::vector<double> samples;
+
+		double median = 0.0;
+		double medianAbsoluteDeviation = 0.0;
+		double mean = 0.0;
+		double standardDeviation = 0.0;
+		double min = 0.0;
+		double max = 0.0;
+	};
+
+private:
+	std::string m_deviceName;
+	std::vector<Result> m_results;
+
+public:
+	[[nodiscard]] static std::string GetResultName(const Result& result);
+	[[nodiscard]] static double GetMillisecondsPerThousandChunks(const Result& result) noexcept;
+	[[nodiscard]] static BenchmarkReport ReadJSON(const class JSONValue& document);
+
+	BenchmarkReport() = default;
+	~BenchmarkReport() noexcept = default;
+
+	void AddResult(const std::string& stage, const std::uint32_t chunkSize, const std::uint32_t octaveCount, const std::size_t chunksPerRepetition, std::vector<double> samplesMicroseconds);
+
+	void Print(std::ostream& outputStream) const;
+	void WriteJSON(const std::string& filepath) const;
+
+	inline void SetDeviceName(const std::string& deviceName) { m_deviceName = deviceName; }
+	inline const std::string& GetDeviceName() const noexcept { return m_deviceName; }
+
+	inline const std::vector<Result>& GetResults() const noexcept { return m_results; }
+
+private:
+	[[nodiscard]] static std::string EscapeJSONString(const std::string& value);
+	[[nodiscard]] static double GetMedian(std::vector<double> values);
+};
\ No newline at end of file
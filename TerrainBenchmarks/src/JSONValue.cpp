@@ -0,0 +1,364 @@
+#include "JSONValue.h"
+
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+JSONValue::Parser::Parser(const std::string_view& text)
+	: m_text(text)
+{ }
+
+[[nodiscard]] JSONValue JSONValue::Parser::ParseDocument()
+{
+	JSONValue value = ParseValue();
+	SkipWhitespace();
+
+	if (m_position != m_text.length())
+	{
+		ThrowError("Unexpected trailing characters");
+	}
+
+	return value;
+}
+
+[[nodiscard]] JSONValue JSONValue::Parser::ParseValue()
+{
+	SkipWhitespace();
+
+	switch (Peek())
+	{
+	case '{':
+		return ParseObject();
+
+	case '[':
+		return ParseArray();
+
+	case '"':
+		return JSONValue(ParseString());
+
+	case 't':
+		ParseLiteral("true");
+
+		return JSONValue(true);
+
+	case 'f':
+		ParseLiteral("false");
+
+		return JSONValue(false);
+
+	case 'n':
+		ParseLiteral("null");
+
+		return JSONValue();
+
+	default:
+		return JSONValue(ParseNumber());
+	}
+}
+
+[[nodiscard]] JSONValue JSONValue::Parser::ParseObject()
+{
+	Expect('{');
+	Object object;
+	SkipWhitespace();
+
+	if (Peek() == '}')
+	{
+		++m_position;
+
+		return JSONValue(std::move(object));
+	}
+
+	while (true)
+	{
+		SkipWhitespace();
+		std::string key = ParseString();
+
+		SkipWhitespace();
+		Expect(':');
+
+		object.insert_or_assign(std::move(key), ParseValue());
+		SkipWhitespace();
+
+		if (Peek() == '}')
+		{
+			++m_position;
+
+			return JSONValue(std::move(object));
+		}
+
+		Expect(',');
+	}
+}
+
+[[nodiscard]] JSONValue JSONValue::Parser::ParseArray()
+{
+	Expect('[');
+	Array array;
+	SkipWhitespace();
+
+	if (Peek() == ']')
+	{
+		++m_position;
+
+		return JSONValue(std::move(array));
+	}
+
+	while (true)
+	{
+		array.push_back(ParseValue());
+		SkipWhitespace();
+
+		if (Peek() == ']')
+		{
+			++m_position;
+
+			return JSONValue(std::move(array));
+		}
+
+		Expect(',');
+	}
+}
+
+[[nodiscard]] std::string JSONValue::Parser::ParseString()
+{
+	Expect('"');
+	std::string value;
+
+	while (m_position < m_text.length() && m_text[m_position] != '"')
+	{
+		char character = m_text[m_position++];
+
+		if (character == '\\')
+		{
+			if (m_position >= m_text.length())
+			{
+				break;
+			}
+
+			switch (const char escapedCharacter = m_text[m_position++]; escapedCharacter)
+			{
+			case 'n':
+				character = '\n';
+
+				break;
+
+			case 't':
+				character = '\t';
+
+				break;
+
+			case 'r':
+				character = '\r';
+
+				break;
+
+			case 'b':
+				character = '\b';
+
+				break;
+
+			case 'f':
+				character = '\f';
+
+				break;
+
+			case 'u':
+				ThrowError("Unicode escape sequences are not supported");
+
+			default:
+				character = escapedCharacter;
+
+				break;
+			}
+		}
+
+		value.push_back(character);
+	}
+
+	Expect('"');
+
+	return value;
+}
+
+[[nodiscard]] double JSONValue::Parser::ParseNumber()
+{
+	const std::size_t startPosition = m_position;
+
+	while (m_position < m_text.length() && (std::isdigit(static_cast<unsigned char>(m_text[m_position])) || m_text[m_position] == '-' || m_text[m_position] == '+' || m_text[m_position] == '.' || m_text[m_position] == 'e' || m_text[m_position] == 'E'))
+	{
+		++m_position;
+	}
+
+	double value = 0.0;
+	const auto [endPointer, errorCode] = std::from_chars(m_text.data() + startPosition, m_text.data() + m_position, value);
+
+	if (startPosition == m_position || errorCode != std::errc{ } || endPointer != m_text.data() + m_position)
+	{
+		m_position = startPosition;
+		ThrowError("Invalid value");
+	}
+
+	return value;
+}
+
+void JSONValue::Parser::ParseLiteral(const std::string_view& literal)
+{
+	if (m_text.substr(m_position, literal.length()) != literal)
+	{
+		ThrowError("Invalid literal");
+	}
+
+	m_position += literal.length();
+}
+
+void JSONValue::Parser::SkipWhitespace() noexcept
+{
+	while (m_position < m_text.length() && std::isspace(static_cast<unsigned char>(m_text[m_position])))
+	{
+		++m_position;
+	}
+}
+
+[[nodiscard]] char JSONValue::Parser::Peek() const noexcept
+{
+	return m_position < m_text.length() ? m_text[m_position] : '\0';
+}
+
+void JSONValue::Parser::Expect(const char character)
+{
+	if (Peek() != character)
+	{
+		ThrowError("Expected '" + std::string(1, character) + "'");
+	}
+
+	++m_position;
+}
+
+void JSONValue::Parser::ThrowError(const std::string& message) const
+{
+	throw std::runtime_error("Failed to parse JSON: " + message + " at offset " + std::to_string(m_position) + ".");
+}
+
+JSONValue::JSONValue(const bool value)
+	: m_value(value)
+{ }
+
+JSONValue::JSONValue(const double value)
+	: m_value(value)
+{ }
+
+JSONValue::JSONValue(std::string value)
+	: m_value(std::move(value))
+{ }
+
+JSONValue::JSONValue(Array value)
+	: m_value(std::move(value))
+{ }
+
+JSONValue::JSONValue(Object value)
+	: m_value(std::move(value))
+{ }
+
+[[nodiscard]] JSONValue JSONValue::Parse(const std::string_view& text)
+{
+	return Parser(text).ParseDocument();
+}
+
+[[nodiscard]] JSONValue JSONValue::ParseFile(const std::string& filepath)
+{
+	std::ifstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open JSON file " + filepath + ".");
+	}
+
+	const std::string text{ std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+
+	return Parse(text);
+}
+
+[[nodiscard]] bool JSONValue::AsBool() const
+{
+	if (!std::holds_alternative<bool>(m_value))
+	{
+		throw std::runtime_error("JSON value is not a boolean.");
+	}
+
+	return std::get<bool>(m_value);
+}
+
+[[nodiscard]] double JSONValue::AsNumber() const
+{
+	if (!std::holds_alternative<double>(m_value))
+	{
+		throw std::runtime_error("JSON value is not a number.");
+	}
+
+	return std::get<double>(m_value);
+}
+
+[[nodiscard]] const std::string& JSONValue::AsString() const
+{
+	if (!std::holds_alternative<std::string>(m_value))
+	{
+		throw std::runtime_error("JSON value is not a string.");
+	}
+
+	return std::get<std::string>(m_value);
+}
+
+[[nodiscard]] const JSONValue::Array& JSONValue::AsArray() const
+{
+	if (!IsArray())
+	{
+		throw std::runtime_error("JSON value is not an array.");
+	}
+
+	return std::get<Array>(m_value);
+}
+
+[[nodiscard]] const JSONValue::Object& JSONValue::AsObject() const
+{
+	if (!IsObject())
+	{
+		throw std::runtime_error("JSON value is not an object.");
+	}
+
+	return std::get<Object>(m_value);
+}
+
+[[nodiscard]] bool JSONValue::Contains(const std::string& key) const
+{
+	return IsObject() && std::get<Object>(m_value).contains(key);
+}
+
+[[nodiscard]] const JSONValue& JSONValue::operator [](const std::string& key) const
+{
+	const Object& object = AsObject();
+	const auto valueLocation = object.find(key);
+
+	if (valueLocation == std::cend(object))
+	{
+		throw std::runtime_error("JSON object has no member " + key + ".");
+	}
+
+	return valueLocation->second;
+}
+
+[[nodiscard]] std::vector<double> JSONValue::AsNumberArray() const
+{
+	std::vector<double> values;
+	values.reserve(AsArray().size());
+
+	for (const auto& element : AsArray())
+	{
+		values.push_back(element.AsNumber());
+	}
+
+	return values;
+}
\ No newline at end of file
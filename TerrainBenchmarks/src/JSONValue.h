@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+class JSONValue
+{
+public:
+	using Array = std::vector<JSONValue>;
+	using Object = std::map<std::string, JSONValue>;
+
+private:
+	class Parser
+	{
+	private:
+		std::string_view m_text;
+		std::size_t m_position = 0u;
+
+	public:
+		explicit Parser(const std::string_view& text);
+
+		[[nodiscard]] JSONValue ParseDocument();
+
+	private:
+		[[nodiscard]] JSONValue ParseValue();
+		[[nodiscard]] JSONValue ParseObject();
+		[[nodiscard]] JSONValue ParseArray();
+		[[nodiscard]] std::string ParseString();
+		[[nodiscard]] double ParseNumber();
+		void ParseLiteral(const std::string_view& literal);
+
+		void SkipWhitespace() noexcept;
+		[[nodiscard]] char Peek() const noexcept;
+		void Expect(const char character);
+
+		[[noreturn]] void ThrowError(const std::string& message) const;
+	};
+
+	std::variant<std::nullptr_t, bool, double, std::string, Array, Object> m_value = nullptr;
+
+public:
+	[[nodiscard]] static JSONValue Parse(const std::string_view& text);
+	[[nodiscard]] static JSONValue ParseFile(const std::string& filepath);
+
+	JSONValue() = default;
+	~JSONValue() noexcept = default;
+
+	inline bool IsNull() const noexcept { return std::holds_alternative<std::nullptr_t>(m_value); }
+	inline bool IsObject() const noexcept { return std::holds_alternative<Object>(m_value); }
+	inline bool IsArray() const noexcept { return std::holds_alternative<Array>(m_value); }
+
+	[[nodiscard]] bool AsBool() const;
+	[[nodiscard]] double AsNumber() const;
+	[[nodiscard]] const std::string& AsString() const;
+	[[nodiscard]] const Array& AsArray() const;
+	[[nodiscard]] const Object& AsObject() const;
+
+	[[nodiscard]] bool Contains(const std::string& key) const;
+	[[nodiscard]] const JSONValue& operator [](const std::string& key) const;
+	[[nodiscard]] std::vector<double> AsNumberArray() const;
+
+private:
+	explicit JSONValue(const bool value);
+	explicit JSONValue(const double value);
+	explicit JSONValue(std::string value);
+	explicit JSONValue(Array value);
+	explicit JSONValue(Object value);
+};
\ No newline at end of file
@@ -0,0 +1,376 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../TerrainGenerator/src/engine/graphics/mesh/VertexCacheOptimiser.h"
+#include "../../TerrainGenerator/src/engine/graphics/renderer/FrameStatistics.h"
+#include "../../TerrainGenerator/src/terrain_generator/Chunk.h"
+#include "BenchmarkComparison.h"
+#include "JSONValue.h"
+#include "StageBenchmarkSuite.h"
+
+namespace
+{
+	constexpr int s_SampleGridLength = 16;
+	constexpr int s_SampleSpacing = 4;
+	constexpr std::size_t s_Repetitions = 8u;
+	constexpr int s_RegressionExitCode = 2;
+
+	struct MeshingResult
+	{
+		std::size_t totalTriangleCount = 0u;
+		std::size_t totalVertexCount = 0u;
+		std::size_t totalIndexCount = 0u;
+		double totalMicroseconds = 0.0;
+	};
+
+	struct VertexCacheResult
+	{
+		VertexCacheOptimiser::Statistics totalStatisticsBefore{ };
+		VertexCacheOptimiser::Statistics totalStatisticsAfter{ };
+
+		std::size_t meshCount = 0u;
+		double totalMicroseconds = 0.0;
+	};
+
+	std::vector<Chunk::HeightMap> CreateSampleNoiseMaps()
+	{
+		std::vector<Chunk::HeightMap> noiseMaps;
+		noiseMaps.reserve(s_SampleGridLength * s_SampleGridLength);
+
+		for (int x = 0; x < s_SampleGridLength; ++x)
+		{
+			for (int z = 0; z < s_SampleGridLength; ++z)
+			{
+				const glm::ivec2 position{ (x - s_SampleGridLength / 2) * s_SampleSpacing, (z - s_SampleGridLength / 2) * s_SampleSpacing };
+				noiseMaps.push_back(Chunk::CreateNoiseMap(position));
+			}
+		}
+
+		return noiseMaps;
+	}
+
+	MeshingResult RunMeshingBenchmark(const std::vector<Chunk::HeightMap>& noiseMaps, const std::function<Chunk::MeshData(const Chunk::HeightMap&)>& mesher, const VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+	{
+		MeshingResult result{ };
+
+		for (std::size_t repetition = 0; repetition < s_Repetitions; ++repetition)
+		{
+			for (const auto& noiseMap : noiseMaps)
+			{
+				const auto startTime = std::chrono::steady_clock::now();
+				const Chunk::MeshData mesh = mesher(noiseMap);
+				const auto endTime = std::chrono::steady_clock::now();
+
+				result.totalMicroseconds += std::chrono::duration<double, std::micro>(endTime - startTime).count();
+
+				if (repetition == 0)
+				{
+					result.totalTriangleCount += topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
+						? FrameStatistics::GetTriangleCount(topology, mesh.indices, Chunk::GetPrimitiveRestartIndex())
+						: FrameStatistics::GetTriangleCount(topology, mesh.indices);
+					result.totalVertexCount += mesh.vertices.size();
+					result.totalIndexCount += mesh.indices.size();
+				}
+			}
+		}
+
+		return result;
+	}
+
+	Chunk::MeshData CreateSharedVertexGridMesh(const Chunk::HeightMap& noiseMap)
+	{
+		const std::size_t rowLength = Chunk::GetChunkWidth() + 1;
+
+		Chunk::MeshData mesh{ };
+
+		for (std::size_t x = 0; x <= Chunk::GetChunkLength(); ++x)
+		{
+			for (std::size_t z = 0; z <= Chunk::GetChunkWidth(); ++z)
+			{
+				mesh.vertices.push_back({ glm::vec3{ x, noiseMap[x][z], z }, Chunk::GetBiomeColour(noiseMap[x][z]), glm::vec3{ 0.0f, 1.0f, 0.0f } });
+			}
+		}
+
+		for (std::size_t x = 0; x < Chunk::GetChunkLength(); ++x)
+		{
+			for (std::size_t z = 0; z < Chunk::GetChunkWidth(); ++z)
+			{
+				const std::uint16_t bottomLeft = static_cast<std::uint16_t>(x * rowLength + z);
+				const std::uint16_t bottomRight = static_cast<std::uint16_t>((x + 1) * rowLength + z);
+
+				for (const std::uint16_t index : { bottomLeft, bottomRight, static_cast<std::uint16_t>(bottomLeft + 1), static_cast<std::uint16_t>(bottomLeft + 1), bottomRight, static_cast<std::uint16_t>(bottomRight + 1) })
+				{
+					mesh.indices.push_back(index);
+				}
+			}
+		}
+
+		return mesh;
+	}
+
+	VertexCacheResult RunVertexCacheBenchmark(const std::vector<Chunk::HeightMap>& noiseMaps, const std::function<Chunk::MeshData(const Chunk::HeightMap&)>& mesher)
+	{
+		VertexCacheResult result{ };
+
+		for (const auto& noiseMap : noiseMaps)
+		{
+			Chunk::MeshData mesh = mesher(noiseMap);
+
+			if (mesh.indices.empty())
+			{
+				continue;
+			}
+
+			const VertexCacheOptimiser::Statistics statisticsBefore = VertexCacheOptimiser::Analyse(mesh.indices, mesh.vertices.size());
+
+			const auto startTime = std::chrono::steady_clock::now();
+			VertexCacheOptimiser::Optimise(mesh.indices, mesh.vertices.size());
+			const auto endTime = std::chrono::steady_clock::now();
+
+			const VertexCacheOptimiser::Statistics statisticsAfter = VertexCacheOptimiser::Analyse(mesh.indices, mesh.vertices.size());
+
+			result.totalStatisticsBefore.averageCacheMissRatio += statisticsBefore.averageCacheMissRatio;
+			result.totalStatisticsBefore.averageTransformToVertexRatio += statisticsBefore.averageTransformToVertexRatio;
+			result.totalStatisticsAfter.averageCacheMissRatio += statisticsAfter.averageCacheMissRatio;
+			result.totalStatisticsAfter.averageTransformToVertexRatio += statisticsAfter.averageTransformToVertexRatio;
+
+			result.totalMicroseconds += std::chrono::duration<double, std::micro>(endTime - startTime).count();
+			++result.meshCount;
+		}
+
+		return result;
+	}
+
+	void PrintVertexCacheResult(const std::string& name, const VertexCacheResult& result)
+	{
+		const double meshCount = static_cast<double>(std::max(result.meshCount, std::size_t{ 1u }));
+
+		std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(3)
+			<< std::setw(14) << result.totalStatisticsBefore.averageCacheMissRatio / meshCount
+			<< std::setw(14) << result.totalStatisticsAfter.averageCacheMissRatio / meshCount
+			<< std::setw(14) << result.totalStatisticsBefore.averageTransformToVertexRatio / meshCount
+			<< std::setw(14) << result.totalStatisticsAfter.averageTransformToVertexRatio / meshCount
+			<< std::setw(14) << std::setprecision(2) << result.totalMicroseconds / meshCount << "\n";
+	}
+
+	struct SuiteOptions
+	{
+		StageBenchmarkSuite::Config config{ };
+		std::optional<std::string> outputFilepath = std::nullopt;
+	};
+
+	std::optional<SuiteOptions> ParseSuiteOptions(const int argc, char* argv[])
+	{
+		SuiteOptions options{ };
+
+		for (int i = 2; i < argc; ++i)
+		{
+			const std::string argument = argv[i];
+
+			if (argument == "--upload")
+			{
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+				options.config.measureUploads = true;
+
+				continue;
+#else
+				throw std::runtime_error("The upload stage requires building with EnableUploadBenchmarks=true.");
+#endif
+			}
+
+			if (++i >= argc)
+			{
+				return std::nullopt;
+			}
+
+			const std::string value = argv[i];
+
+			if (argument == "--repetitions")
+			{
+				options.config.repetitions = std::stoul(value);
+
+				if (options.config.repetitions == 0)
+				{
+					return std::nullopt;
+				}
+			}
+			else if (argument == "--output")
+			{
+				options.outputFilepath = value;
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
+
+		return options;
+	}
+
+	int RunStageBenchmarkSuite(const int argc, char* argv[])
+	{
+		const std::optional<SuiteOptions> options = ParseSuiteOptions(argc, argv);
+
+		if (!options.has_value())
+		{
+			std::cerr << "Usage: " << argv[0] << " --suite [--repetitions <count>] [--output <report.json>] [--upload]\n";
+
+			return EXIT_FAILURE;
+		}
+
+		std::cout << "Running stage benchmarks, " << options->config.repetitions << " repetitions (" << options->config.warmupRepetitions << " warm-up).\n\n";
+
+		const BenchmarkReport report = StageBenchmarkSuite(options->config).Run();
+		report.Print(std::cout);
+
+		if (options->outputFilepath.has_value())
+		{
+			report.WriteJSON(options->outputFilepath.value());
+			std::cout << "\nWrote benchmark report to " << options->outputFilepath.value() << ".\n";
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+	std::optional<BenchmarkComparison::Config> ParseComparisonConfig(const int argc, char* argv[])
+	{
+		constexpr double PercentageScale = 100.0;
+
+		BenchmarkComparison::Config config{ };
+
+		for (int i = 4; i < argc; i += 2)
+		{
+			if (i + 1 >= argc)
+			{
+				return std::nullopt;
+			}
+
+			const std::string argument = argv[i];
+			const double value = std::stod(argv[i + 1]);
+
+			if (argument == "--threshold" && value >= 0.0)
+			{
+				config.regressionThreshold = value / PercentageScale;
+			}
+			else if (argument == "--significance" && value > 0.0 && value < 1.0)
+			{
+				config.significanceLevel = value;
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
+
+		return config;
+	}
+
+	int RunComparison(const int argc, char* argv[])
+	{
+		const std::optional<BenchmarkComparison::Config> config = argc >= 4 ? ParseComparisonConfig(argc, argv) : std::nullopt;
+
+		if (!config.has_value())
+		{
+			std::cerr << "Usage: " << argv[0] << " --compare <baseline.json> <current.json> [--threshold <percent>] [--significance <level>]\n";
+
+			return EXIT_FAILURE;
+		}
+
+		const BenchmarkComparison comparison(JSONValue::ParseFile(argv[2]), JSONValue::ParseFile(argv[3]), config.value());
+		comparison.Print(std::cout);
+
+		if (comparison.HasRegressions())
+		{
+			std::cout << "\nPerformance regressions detected against " << argv[2] << ".\n";
+
+			return s_RegressionExitCode;
+		}
+
+		return EXIT_SUCCESS;
+	}
+
+	void PrintResult(const std::string& name, const MeshingResult& result, const std::size_t chunkCount)
+	{
+		std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(16) << static_cast<double>(result.totalTriangleCount) / chunkCount
+			<< std::setw(16) << static_cast<double>(result.totalVertexCount) / chunkCount
+			<< std::setw(16) << static_cast<double>(result.totalIndexCount) / chunkCount
+			<< std::setw(16) << result.totalTriangleCount
+			<< std::setw(16) << std::setprecision(2) << result.totalMicroseconds / (chunkCount * s_Repetitions) << "\n";
+	}
+}
+
+int main(const int argc, char* argv[])
+try
+{
+	if (argc > 1 && std::string(argv[1]) == "--suite")
+	{
+		return RunStageBenchmarkSuite(argc, argv);
+	}
+
+	if (argc > 1 && std::string(argv[1]) == "--compare")
+	{
+		return RunComparison(argc, argv);
+	}
+
+	const std::vector<Chunk::HeightMap> noiseMaps = CreateSampleNoiseMaps();
+
+	std::cout << "Meshing " << noiseMaps.size() << " chunks (" << Chunk::GetChunkLength() << "x" << Chunk::GetChunkWidth() << "), " << s_Repetitions << " repetitions.\n\n";
+	std::cout << std::left << std::setw(20) << "Mesher" << std::right
+		<< std::setw(16) << "Tris/chunk"
+		<< std::setw(16) << "Verts/chunk"
+		<< std::setw(16) << "Indices/chunk"
+		<< std::setw(16) << "Total tris"
+		<< std::setw(16) << "us/chunk" << "\n";
+
+	PrintResult("Grid", RunMeshingBenchmark(noiseMaps, Chunk::CreateGridMesh), noiseMaps.size());
+	PrintResult("Grid strip", RunMeshingBenchmark(noiseMaps, Chunk::CreateGridStripMesh, VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP), noiseMaps.size());
+
+	for (const float maxError : { 0.25f, 0.5f, 1.0f, 2.0f, 4.0f })
+	{
+		std::ostringstream name;
+		name << "RTIN (error " << maxError << ")";
+
+		PrintResult(name.str(), RunMeshingBenchmark(noiseMaps, [maxError](const Chunk::HeightMap& noiseMap) { return Chunk::CreateRTINMesh(noiseMap, maxError); }), noiseMaps.size());
+	}
+
+	std::cout << "\nVertex cache (FIFO " << VertexCacheOptimiser::GetDefaultAnalysisCacheSize() << ").\n\n";
+	std::cout << std::left << std::setw(20) << "Mesher" << std::right
+		<< std::setw(14) << "ACMR before"
+		<< std::setw(14) << "ACMR after"
+		<< std::setw(14) << "ATVR before"
+		<< std::setw(14) << "ATVR after"
+		<< std::setw(14) << "us/chunk" << "\n";
+
+	PrintVertexCacheResult("Grid", RunVertexCacheBenchmark(noiseMaps, Chunk::CreateGridMesh));
+	PrintVertexCacheResult("RTIN", RunVertexCacheBenchmark(noiseMaps, [](const Chunk::HeightMap& noiseMap) { return Chunk::CreateRTINMesh(noiseMap); }));
+	PrintVertexCacheResult("Shared grid", RunVertexCacheBenchmark(noiseMaps, CreateSharedVertexGridMesh));
+
+	return EXIT_SUCCESS;
+}
+catch (const std::exception& error)
+{
+	std::cerr << error.what() << "\n";
+
+	return EXIT_FAILURE;
+}
+catch (...)
+{
+	std::cerr << "Unknown error.\n";
+
+	return EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include "StageBenchmarkSuite.h"
+
+#include <chrono>
+#include <string>
+#include <utility>
+
+#include <vulkan/vulkan.h>
+
+#include "../../TerrainGenerator/src/engine/graphics/mesh/MeshletBuilder.h"
+
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+#include "../../TerrainGenerator/src/engine/graphics/buffers/IndexBuffer.h"
+#include "../../TerrainGenerator/src/engine/graphics/buffers/VertexBuffer.h"
+#include "../../TerrainGenerator/src/engine/graphics/renderer/Renderer.h"
+#endif
+
+namespace
+{
+	volatile float s_benchmarkSink = 0.0f;
+}
+
+StageBenchmarkSuite::StageBenchmarkSuite(const Config& config)
+	: m_config(config)
+{ }
+
+[[nodiscard]] BenchmarkReport StageBenchmarkSuite::Run() const
+{
+	BenchmarkReport report;
+
+	for (const std::uint32_t chunkSize : m_config.chunkSizes)
+	{
+		RunCPUStages(report, chunkSize);
+	}
+
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+	if (m_config.measureUploads)
+	{
+		RunUploadStage(report);
+	}
+#endif
+
+	return report;
+}
+
+[[nodiscard]] std::vector<glm::ivec2> StageBenchmarkSuite::GetSamplePositions()
+{
+	std::vector<glm::ivec2> positions;
+	positions.reserve(s_SampleGridLength * s_SampleGridLength);
+
+	for (int x = 0; x < s_SampleGridLength; ++x)
+	{
+		for (int z = 0; z < s_SampleGridLength; ++z)
+		{
+			positions.emplace_back((x - s_SampleGridLength / 2) * s_SampleSpacing, (z - s_SampleGridLength / 2) * s_SampleSpacing);
+		}
+	}
+
+	return positions;
+}
+
+[[nodiscard]] std::vector<Chunk::HeightMap> StageBenchmarkSuite::CreateNoiseMaps(const Chunk::NoiseSettings& noiseSettings)
+{
+	std::vector<Chunk::HeightMap> noiseMaps;
+
+	for (const auto& position : GetSamplePositions())
+	{
+		noiseMaps.push_back(Chunk::CreateNoiseMap(position, noiseSettings));
+	}
+
+	return noiseMaps;
+}
+
+[[nodiscard]] std::vector<double> StageBenchmarkSuite::Measure(const std::size_t chunkCount, const std::function<void(std::size_t)>& stageFunction) const
+{
+	std::vector<double> samples;
+	samples.reserve(m_config.repetitions);
+
+	for (std::size_t repetition = 0; repetition < m_config.warmupRepetitions + m_config.repetitions; ++repetition)
+	{
+		const auto startTime = std::chrono::steady_clock::now();
+
+		for (std::size_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+		{
+			stageFunction(chunkIndex);
+		}
+
+		const auto endTime = std::chrono::steady_clock::now();
+
+		if (repetition >= m_config.warmupRepetitions)
+		{
+			samples.push_back(std::chrono::duration<double, std::micro>(endTime - startTime).count() / static_cast<double>(chunkCount));
+		}
+	}
+
+	return samples;
+}
+
+void StageBenchmarkSuite::RunCPUStages(BenchmarkReport& report, const std::uint32_t chunkSize) const
+{
+	const std::vector<glm::ivec2> positions = GetSamplePositions();
+
+	for (const std::uint32_t octaveCount : m_config.octaveCounts)
+	{
+		const Chunk::NoiseSettings noiseSettings{ chunkSize, chunkSize, octaveCount };
+
+		report.AddResult("CreateNoiseMap", chunkSize, octaveCount, positions.size(), Measure(positions.size(), [&positions, &noiseSettings](const std::size_t chunkIndex)
+		{
+			s_benchmarkSink = s_benchmarkSink + Chunk::CreateNoiseMap(positions[chunkIndex], noiseSettings)[0][0];
+		}));
+	}
+
+	const Chunk::NoiseSettings noiseSettings{ chunkSize, chunkSize, Chunk::GetDefaultOctaveCount() };
+	const std::vector<Chunk::HeightMap> noiseMaps = CreateNoiseMaps(noiseSettings);
+
+	report.AddResult("GetBiomeColour", chunkSize, noiseSettings.octaveCount, noiseMaps.size(), Measure(noiseMaps.size(), [&noiseMaps](const std::size_t chunkIndex)
+	{
+		glm::vec3 colourSum{ 0.0f, 0.0f, 0.0f };
+
+		for (const auto& row : noiseMaps[chunkIndex])
+		{
+			for (const float height : row)
+			{
+				colourSum += Chunk::GetBiomeColour(height);
+			}
+		}
+
+		s_benchmarkSink = s_benchmarkSink + colourSum.r;
+	}));
+
+	report.AddResult("CalculateTriangleNormal", chunkSize, noiseSettings.octaveCount, noiseMaps.size(), Measure(noiseMaps.size(), [&noiseMaps, chunkSize](const std::size_t chunkIndex)
+	{
+		const Chunk::HeightMap& noiseMap = noiseMaps[chunkIndex];
+		glm::vec3 normalSum{ 0.0f, 0.0f, 0.0f };
+
+		for (std::size_t x = 0; x < chunkSize; ++x)
+		{
+			for (std::size_t z = 0; z < chunkSize; ++z)
+			{
+				const glm::vec3 bottomLeft{ x, noiseMap[x][z], z };
+				const glm::vec3 bottomRight{ 1.0f + x, noiseMap[x + 1][z], z };
+				const glm::vec3 topLeft{ x, noiseMap[x][z + 1], 1.0f + z };
+				const glm::vec3 topRight{ 1.0f + x, noiseMap[x + 1][z + 1], 1.0f + z };
+
+				normalSum += Chunk::CalculateTriangleNormal(bottomLeft, bottomRight, topLeft);
+				normalSum += Chunk::CalculateTriangleNormal(topLeft, bottomRight, topRight);
+			}
+		}
+
+		s_benchmarkSink = s_benchmarkSink + normalSum.y;
+	}));
+
+	const std::vector<std::pair<std::string, Chunk::MeshType>> meshTypes{
+		{ "InitialiseVertices (grid)", Chunk::MeshType::Grid },
+		{ "InitialiseVertices (grid strip)", Chunk::MeshType::GridStrip },
+		{ "InitialiseVertices (RTIN)", Chunk::MeshType::RTIN }
+	};
+
+	for (const auto& [stage, meshType] : meshTypes)
+	{
+		if (meshType == Chunk::MeshType::RTIN && chunkSize != Chunk::GetChunkLength())
+		{
+			continue;
+		}
+
+		report.AddResult(stage, chunkSize, noiseSettings.octaveCount, noiseMaps.size(), Measure(noiseMaps.size(), [&noiseMaps, meshType = meshType](const std::size_t chunkIndex)
+		{
+			const Chunk::MeshData mesh = Chunk::CreateMesh(noiseMaps[chunkIndex], meshType);
+
+			if (!mesh.indices.empty() && Chunk::GetPrimitiveTopology(meshType) == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
+			{
+				s_benchmarkSink = s_benchmarkSink + static_cast<float>(MeshletBuilder::Build(mesh.vertices, mesh.indices).meshlets.size());
+			}
+		}));
+	}
+}
+
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+void StageBenchmarkSuite::RunUploadStage(BenchmarkReport& report) const
+{
+	Renderer renderer(VkExtent2D{ 64u, 64u });
+
+	VkPhysicalDeviceProperties physicalDeviceProperties{ };
+	vkGetPhysicalDeviceProperties(renderer.GetVulkanContext().GetPhysicalDevice(), &physicalDeviceProperties);
+	report.SetDeviceName(physicalDeviceProperties.deviceName);
+
+	for (const std::uint32_t chunkSize : m_config.chunkSizes)
+	{
+		std::vector<Chunk::MeshData> meshes;
+
+		for (const auto& noiseMap : CreateNoiseMaps(Chunk::NoiseSettings{ chunkSize, chunkSize, Chunk::GetDefaultOctaveCount() }))
+		{
+			Chunk::MeshData mesh = Chunk::CreateMesh(noiseMap, Chunk::MeshType::Grid);
+
+			if (!mesh.indices.empty())
+			{
+				meshes.push_back(std::move(mesh));
+			}
+		}
+
+		if (meshes.empty())
+		{
+			continue;
+		}
+
+		report.AddResult("Buffer::Create", chunkSize, Chunk::GetDefaultOctaveCount(), meshes.size(), Measure(meshes.size(), [&renderer, &meshes](const std::size_t chunkIndex)
+		{
+			VertexBuffer vertexBuffer(renderer);
+			vertexBuffer.Initialise(meshes[chunkIndex].vertices);
+
+			IndexBuffer indexBuffer(renderer);
+			indexBuffer.Initialise(meshes[chunkIndex].indices);
+		}));
+	}
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "../../TerrainGenerator/src/terrain_generator/Chunk.h"
+#include "BenchmarkReport.h"
+
+class StageBenchmarkSuite
+{
+public:
+	struct Config
+	{
+		std::size_t repetitions = 21u;
+		std::size_t warmupRepetitions = 2u;
+
+		std::vector<std::uint32_t> chunkSizes{ 16u, 32u, 64u };
+		std::vector<std::uint32_t> octaveCounts{ 1u, 3u, 5u, 8u };
+
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+		bool measureUploads = false;
+#endif
+	};
+
+private:
+	static constexpr int s_SampleGridLength = 8;
+	static constexpr int s_SampleSpacing = 4;
+
+	Config m_config;
+
+public:
+	explicit StageBenchmarkSuite(const Config& config);
+	~StageBenchmarkSuite() noexcept = default;
+
+	[[nodiscard]] BenchmarkReport Run() const;
+
+private:
+	[[nodiscard]] static std::vector<glm::ivec2> GetSamplePositions();
+	[[nodiscard]] static std::vector<Chunk::HeightMap> CreateNoiseMaps(const Chunk::NoiseSettings& noiseSettings);
+
+	[[nodiscard]] std::vector<double> Measure(const std::size_t chunkCount, const std::function<void(std::size_t)>& stageFunction) const;
+
+	void RunCPUStages(BenchmarkReport& report, const std::uint32_t chunkSize) const;
+
+#ifdef ENABLE_UPLOAD_BENCHMARKS
+	void RunUploadStage(BenchmarkReport& report) const;
+#endif
+};
\ No newline at end of file
@@ -6,6 +6,17 @@ layout (location = 2) in vec3 v_fragmentPosition;
 
 layout (location = 0) out vec4 out_colour;
 
+// Light parameters are supplied by World through specialisation constants.
+layout (constant_id = 0) const float c_lightPositionX = 0.0;
+layout (constant_id = 1) const float c_lightPositionY = 0.0;
+layout (constant_id = 2) const float c_lightPositionZ = 0.0;
+
+layout (constant_id = 3) const float c_lightColourR = 0.0;
+layout (constant_id = 4) const float c_lightColourG = 0.0;
+layout (constant_id = 5) const float c_lightColourB = 0.0;
+
+layout (constant_id = 6) const float c_ambientStrength = 0.0;
+
 struct Light {
 	vec3 position;
 	vec3 colour;
@@ -15,9 +26,9 @@ struct Light {
 
 void main()
 {
-	g_light.position = vec3(0.0, 128.0, 0.0);
-	g_light.colour = vec3(1.0, 1.0, 1.0);
-	g_light.ambientStrength = 0.3;
+	g_light.position = vec3(c_lightPositionX, c_lightPositionY, c_lightPositionZ);
+	g_light.colour = vec3(c_lightColourR, c_lightColourG, c_lightColourB);
+	g_light.ambientStrength = c_ambientStrength;
 
 	const vec3 ambientLight = g_light.ambientStrength * g_light.colour;
 
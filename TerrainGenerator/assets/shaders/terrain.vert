@@ -19,11 +19,18 @@ layout (std140, set = 0, binding = 0) uniform VP
 	mat4 projection;
 } u_ViewProjection;
 
+layout (std430, set = 1, binding = 0) readonly buffer ChunkOrigins
+{
+	vec4 origins[];
+} u_ChunkOrigins;
+
 void main()
 {
+	const vec3 position = in_position + u_ChunkOrigins.origins[gl_InstanceIndex].xyz;
+
 	v_colour = in_colour;
 	v_normal = in_normal;
-	v_fragmentPosition = vec3(u_Model.model * vec4(in_position, 1.0));
+	v_fragmentPosition = vec3(u_Model.model * vec4(position, 1.0));
 
-	gl_Position = u_ViewProjection.projection * u_ViewProjection.view * u_Model.model * vec4(in_position, 1.0);
+	gl_Position = u_ViewProjection.projection * u_ViewProjection.view * u_Model.model * vec4(position, 1.0);
 }
\ No newline at end of file
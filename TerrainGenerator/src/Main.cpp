@@ -1,15 +1,148 @@
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <SDL2/SDL.h>
 
+#include "engine/graphics/pipeline/ShaderArchive.h"
+#include "terrain_generator/HeadlessTerrainGenerator.h"
 #include "terrain_generator/TerrainGenerator.h"
 
+namespace
+{
+	[[nodiscard]] std::optional<HeadlessTerrainGenerator::Config> ParseHeadlessConfig(const int argc, char* argv[])
+	{
+		HeadlessTerrainGenerator::Config config{ };
+
+		for (int i = 2; i < argc; ++i)
+		{
+			const std::string argument(argv[i]);
+
+			if (i + 1 >= argc)
+			{
+				return std::nullopt;
+			}
+
+			const std::string value(argv[++i]);
+
+			if (argument == "--frames")
+			{
+				config.frameCount = static_cast<std::uint32_t>(std::stoul(value));
+			}
+			else if (argument == "--size")
+			{
+				const std::size_t separatorIndex = value.find('x');
+
+				if (separatorIndex == std::string::npos)
+				{
+					return std::nullopt;
+				}
+
+				config.size = glm::uvec2{ std::stoul(value.substr(0, separatorIndex)), std::stoul(value.substr(separatorIndex + 1)) };
+
+				if (config.size.x == 0 || config.size.y == 0)
+				{
+					return std::nullopt;
+				}
+			}
+			else if (argument == "--camera-path")
+			{
+				config.cameraPathFilepath = value;
+			}
+			else if (argument == "--benchmark")
+			{
+				config.benchmarkFilepath = value;
+			}
+			else if (argument == "--capture")
+			{
+				config.captureFilepath = value;
+			}
+			else if (argument == "--frame-statistics")
+			{
+				config.frameStatisticsFilepath = value;
+			}
+			else if (argument == "--memory-report")
+			{
+				config.memoryReportFilepath = value;
+			}
+			else if (argument == "--cpu-memory-budget")
+			{
+				constexpr std::uint64_t BytesPerMebibyte = 1'024u * 1'024u;
+
+				config.worldConfig.cpuMemoryBudget = std::stoull(value) * BytesPerMebibyte;
+
+				if (config.worldConfig.cpuMemoryBudget == 0u)
+				{
+					return std::nullopt;
+				}
+			}
+			else
+			{
+				return std::nullopt;
+			}
+		}
+
+		return config;
+	}
+}
+
 int main(const int argc, char* argv[])
 try
 {
-	TerrainGenerator terrainGenerator;
+	if (argc > 1 && std::string(argv[1]) == "--build-shader-archive")
+	{
+		if (argc < 4)
+		{
+			std::cerr << "Usage: " << argv[0] << " --build-shader-archive <archive> <shader.spv>...\n";
+
+			return EXIT_FAILURE;
+		}
+
+		ShaderArchive::Build(argv[2], std::vector<std::string>(argv + 3, argv + argc));
+		std::cout << "Built shader archive " << argv[2] << " with " << argc - 3 << " shaders.\n";
+
+		return EXIT_SUCCESS;
+	}
+
+	if (argc > 1 && std::string(argv[1]) == "--headless")
+	{
+		try
+		{
+			const std::optional<HeadlessTerrainGenerator::Config> headlessConfig = ParseHeadlessConfig(argc, argv);
+
+			if (!headlessConfig.has_value())
+			{
+				std::cerr << "Usage: " << argv[0] << " --headless [--frames <count>] [--size <width>x<height>] [--camera-path <path.txt>] [--benchmark <report.json>] [--capture <frame.ppm>] [--frame-statistics <statistics.csv|statistics.json>] [--memory-report <allocator.json>] [--cpu-memory-budget <MiB>]\n";
+
+				return EXIT_FAILURE;
+			}
+
+			HeadlessTerrainGenerator headlessTerrainGenerator(headlessConfig.value());
+			headlessTerrainGenerator.Run();
+
+			return EXIT_SUCCESS;
+		}
+		catch (const std::exception& error)
+		{
+			std::cerr << error.what() << "\n";
+
+			return EXIT_FAILURE;
+		}
+	}
+
+	std::optional<std::string> cameraRecordingFilepath = std::nullopt;
+
+	if (argc > 2 && std::string(argv[1]) == "--record-camera")
+	{
+		cameraRecordingFilepath = argv[2];
+	}
+
+	TerrainGenerator terrainGenerator(cameraRecordingFilepath);
 	terrainGenerator.Run();
 
 	return EXIT_SUCCESS;
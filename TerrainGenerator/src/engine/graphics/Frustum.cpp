@@ -0,0 +1,37 @@
+#include "Frustum.h"
+
+Frustum::Frustum(const glm::mat4& viewProjection)
+{
+	const glm::vec4 rowX{ viewProjection[0][0], viewProjection[1][0], viewProjection[2][0], viewProjection[3][0] };
+	const glm::vec4 rowY{ viewProjection[0][1], viewProjection[1][1], viewProjection[2][1], viewProjection[3][1] };
+	const glm::vec4 rowZ{ viewProjection[0][2], viewProjection[1][2], viewProjection[2][2], viewProjection[3][2] };
+	const glm::vec4 rowW{ viewProjection[0][3], viewProjection[1][3], viewProjection[2][3], viewProjection[3][3] };
+
+	// The near plane assumes a zero-to-one depth range.
+	m_planes = {
+		rowW + rowX,
+		rowW - rowX,
+		rowW + rowY,
+		rowW - rowY,
+		rowZ,
+		rowW - rowZ
+	};
+
+	for (auto& plane : m_planes)
+	{
+		plane /= glm::length(glm::vec3{ plane });
+	}
+}
+
+[[nodiscard]] bool Frustum::ContainsSphere(const glm::vec3& centre, const float radius) const
+{
+	for (const auto& plane : m_planes)
+	{
+		if (glm::dot(glm::vec3{ plane }, centre) + plane.w < -radius)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
\ No newline at end of file
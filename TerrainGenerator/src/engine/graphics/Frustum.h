@@ -0,0 +1,18 @@
+#pragma once
+
+#include <array>
+
+#include <glm/glm.hpp>
+
+class Frustum
+{
+private:
+	std::array<glm::vec4, 6u> m_planes{ };
+
+public:
+	Frustum() = default;
+	explicit Frustum(const glm::mat4& viewProjection);
+	~Frustum() noexcept = default;
+
+	[[nodiscard]] bool ContainsSphere(const glm::vec3& centre, const float radius) const;
+};
\ No newline at end of file
@@ -2,9 +2,11 @@
 
 #include <cstddef>
 #include <cstring>
+#include <stdexcept>
 
 #include "../renderer/Renderer.h"
 #include "../renderer/VulkanUtility.h"
+#include "../../utility/Profiler.h"
 
 Buffer::Buffer(const Renderer& renderer)
 	: m_renderer(renderer)
@@ -17,19 +19,44 @@ Buffer::~Buffer() noexcept
 
 void Buffer::Destroy() noexcept
 {
-	if (m_bufferHandle != VK_NULL_HANDLE)
+	vulkan_util::DestroyBuffer(m_renderer.GetVulkanContext(), m_bufferHandle, m_allocation);
+}
+
+void Buffer::Rebind()
+{
+	const VkBuffer previousBufferHandle = m_bufferHandle;
+	vulkan_util::RebindBuffer(m_renderer.GetVulkanContext(), m_bufferSize, m_usageFlags, m_allocation, m_bufferHandle);
+
+	m_renderer.DeferDeletion([&vulkanContext = m_renderer.GetVulkanContext(), previousBufferHandle]()
 	{
-		vmaDestroyBuffer(m_renderer.GetVulkanContext().GetAllocator(), m_bufferHandle, m_allocation);
-		m_bufferHandle = VK_NULL_HANDLE;
-		m_allocation = VK_NULL_HANDLE;
-	}
+		vkDestroyBuffer(vulkanContext.GetLogicalDevice(), previousBufferHandle, nullptr);
+	});
 }
 
 void Buffer::Create(const void* bufferData, const VkDeviceSize bufferSize, const Usage usage)
 {
+	PROFILE_SCOPE("Buffer::Create");
+
+	m_bufferSize = bufferSize;
+	m_usageFlags = VK_BUFFER_USAGE_TRANSFER_DST_BIT | static_cast<VkBufferUsageFlagBits>(usage);
+
+	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), m_bufferSize, m_usageFlags, VMA_MEMORY_USAGE_GPU_ONLY, GetMemoryCategory(usage), m_bufferHandle, m_allocation);
+	Upload(bufferData, bufferSize);
+}
+
+void Buffer::Upload(const void* bufferData, const VkDeviceSize bufferSize)
+{
+	if (bufferSize > m_bufferSize)
+	{
+		throw std::invalid_argument("Buffer upload exceeds the size of the Vulkan buffer.");
+	}
+
+	FrameStatistics& frameStatistics = m_renderer.GetFrameStatistics();
+	frameStatistics.BeginStaging(bufferSize);
+
 	VkBuffer stagingBuffer = VK_NULL_HANDLE;
 	VmaAllocation stagingAllocation = VK_NULL_HANDLE;
-	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, stagingBuffer, stagingAllocation);
+	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), bufferSize, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_CPU_ONLY, MemoryTracker::Category::StagingBuffers, stagingBuffer, stagingAllocation);
 
 	void* vertexData = nullptr;
 
@@ -39,10 +66,26 @@ void Buffer::Create(const void* bufferData, const VkDeviceSize bufferSize, const
 	}
 	vmaUnmapMemory(m_renderer.GetVulkanContext().GetAllocator(), stagingAllocation);
 
-	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), bufferSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT | static_cast<VkBufferUsageFlagBits>(usage), VMA_MEMORY_USAGE_GPU_ONLY, m_bufferHandle, m_allocation);
 	vulkan_util::CopyBuffer(m_renderer.GetVulkanContext(), stagingBuffer, m_bufferHandle, bufferSize);
 
-	vmaDestroyBuffer(m_renderer.GetVulkanContext().GetAllocator(), stagingBuffer, stagingAllocation);
-	stagingBuffer = VK_NULL_HANDLE;
-	stagingAllocation = VK_NULL_HANDLE;
+	vulkan_util::DestroyBuffer(m_renderer.GetVulkanContext(), stagingBuffer, stagingAllocation);
+
+	frameStatistics.EndStaging(bufferSize);
+	frameStatistics.Add(FrameStatistics::Statistic::BytesUploaded, bufferSize);
+}
+
+[[nodiscard]] MemoryTracker::Category Buffer::GetMemoryCategory(const Usage usage) noexcept
+{
+	switch (usage)
+	{
+	case Usage::Index:
+		return MemoryTracker::Category::IndexBuffers;
+
+	case Usage::Storage:
+		return MemoryTracker::Category::StorageBuffers;
+
+	case Usage::Vertex:
+	default:
+		return MemoryTracker::Category::VertexBuffers;
+	}
 }
\ No newline at end of file
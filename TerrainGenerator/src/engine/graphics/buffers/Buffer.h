@@ -2,6 +2,7 @@
 
 #include "../../utility/interfaces/INoncopyable.h"
 #include "../../utility/interfaces/INonmovable.h"
+#include "../../utility/MemoryTracker.h"
 
 #include <type_traits>
 
@@ -16,7 +17,8 @@ protected:
 		: std::underlying_type_t<VkBufferUsageFlagBits>
 	{
 		Vertex = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT,
-		Index = VK_BUFFER_USAGE_INDEX_BUFFER_BIT
+		Index = VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+		Storage = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT
 	};
 
 	const class Renderer& m_renderer;
@@ -24,14 +26,23 @@ protected:
 	VkBuffer m_bufferHandle = VK_NULL_HANDLE;
 	VmaAllocation m_allocation = VK_NULL_HANDLE;
 
+	VkDeviceSize m_bufferSize = 0;
+	VkBufferUsageFlags m_usageFlags = 0;
+
 public:
 	Buffer(const class Renderer& renderer);
 	~Buffer() noexcept;
 
 	void Destroy() noexcept;
+	void Rebind();
 
 	inline const VkBuffer& GetHandle() const noexcept { return m_bufferHandle; }
+	inline VmaAllocation GetAllocation() const noexcept { return m_allocation; }
 
 protected:
 	void Create(const void* bufferData, const VkDeviceSize bufferSize, const Usage usage);
+	void Upload(const void* bufferData, const VkDeviceSize bufferSize);
+
+private:
+	[[nodiscard]] static MemoryTracker::Category GetMemoryCategory(const Usage usage) noexcept;
 };
\ No newline at end of file
@@ -0,0 +1,284 @@
+#include "BufferDefragmenter.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <stdexcept>
+#include <utility>
+
+#include "../renderer/Renderer.h"
+#include "../../utility/Profiler.h"
+
+[[nodiscard]] float BufferDefragmenter::FragmentationStatistics::GetFragmentation() const noexcept
+{
+	if (unusedBytes == 0u)
+	{
+		return 0.0f;
+	}
+
+	return 1.0f - static_cast<float>(largestUnusedRange) / static_cast<float>(unusedBytes);
+}
+
+BufferDefragmenter::BufferDefragmenter(Renderer& renderer)
+	: BufferDefragmenter(renderer, Config{ })
+{ }
+
+BufferDefragmenter::BufferDefragmenter(Renderer& renderer, const Config& config)
+	: m_renderer(renderer), m_config(config), m_framesUntilNextCheck(config.frameInterval)
+{ }
+
+std::optional<BufferDefragmenter::PassResult> BufferDefragmenter::Update(const std::function<std::vector<Buffer*>()>& getBuffers)
+{
+	if (m_completedPass.has_value())
+	{
+		return std::exchange(m_completedPass, std::nullopt);
+	}
+
+	if (m_activePass != nullptr)
+	{
+		if (m_activePass->isEnded)
+		{
+			CompletePass();
+		}
+		else if (m_activePass->isRecorded && !m_activePass->isCompletionDeferred)
+		{
+			// The frame holding the moves has been submitted by now, so the pass can complete once its fence signals.
+			m_renderer.DeferDeletion([this, pass = m_activePass]()
+			{
+				if (!pass->isEnded)
+				{
+					CompletePass();
+				}
+			});
+
+			m_activePass->isCompletionDeferred = true;
+		}
+
+		return std::nullopt;
+	}
+
+	if (m_framesUntilNextCheck > 0u)
+	{
+		--m_framesUntilNextCheck;
+
+		return std::nullopt;
+	}
+
+	m_framesUntilNextCheck = m_config.frameInterval * m_backoffMultiplier;
+
+	std::vector<Buffer*> movableBuffers = getBuffers();
+	std::erase_if(movableBuffers, [](const Buffer* const buffer) { return buffer == nullptr || buffer->GetAllocation() == VK_NULL_HANDLE; });
+
+	if (movableBuffers.empty())
+	{
+		return std::nullopt;
+	}
+
+	const std::uint32_t memoryTypeBits = GetMemoryTypeBits(movableBuffers);
+	const FragmentationStatistics fragmentationStatistics = GetFragmentationStatistics(memoryTypeBits);
+
+	if (fragmentationStatistics.unusedBytes < m_config.minUnusedBytes || fragmentationStatistics.GetFragmentation() < m_config.fragmentationThreshold)
+	{
+		return std::nullopt;
+	}
+
+	BeginPass(movableBuffers, memoryTypeBits, fragmentationStatistics);
+
+	return std::nullopt;
+}
+
+void BufferDefragmenter::Postpone() noexcept
+{
+	m_framesUntilNextCheck = std::max(m_framesUntilNextCheck, Renderer::GetMaxFramesInFlight());
+}
+
+void BufferDefragmenter::Finish()
+{
+	if (m_activePass == nullptr)
+	{
+		return;
+	}
+
+	if (m_activePass->isRecorded && !m_activePass->isEnded)
+	{
+		m_renderer.GetVulkanContext().WaitOnGraphicsQueue();
+		EndPass(m_renderer.GetVulkanContext().GetAllocator(), *m_activePass);
+	}
+
+	m_activePass->isEnded = true;
+	m_activePass = nullptr;
+}
+
+void BufferDefragmenter::BeginPass(const std::vector<Buffer*>& buffers, const std::uint32_t memoryTypeBits, const FragmentationStatistics& fragmentationStatistics)
+{
+	m_activePass = std::make_shared<Pass>();
+	m_activePass->buffers = buffers;
+	m_activePass->memoryTypeBits = memoryTypeBits;
+	m_activePass->before = fragmentationStatistics;
+
+	m_renderer.DeferTransferCommands([&renderer = m_renderer, config = m_config, pass = m_activePass](VkCommandBuffer commandBuffer)
+	{
+		RecordPass(renderer, config, *pass, commandBuffer);
+	});
+}
+
+void BufferDefragmenter::CompletePass()
+{
+	PROFILE_SCOPE("BufferDefragmenter::CompletePass");
+
+	const std::shared_ptr<Pass> pass = m_activePass;
+	m_activePass = nullptr;
+
+	if (!pass->isEnded)
+	{
+		// Frames recorded after the moves still draw from the old ranges, which ending the pass releases.
+		m_renderer.WaitForFramesInFlight();
+		EndPass(m_renderer.GetVulkanContext().GetAllocator(), *pass);
+
+		for (std::size_t i = 0; i < pass->buffers.size(); ++i)
+		{
+			if (pass->allocationsChanged[i])
+			{
+				pass->buffers[i]->Rebind();
+			}
+		}
+
+		m_renderer.InvalidateSecondaryCommandBuffers();
+	}
+
+	PassResult passResult{ };
+	passResult.before = pass->before;
+	passResult.after = GetFragmentationStatistics(pass->memoryTypeBits);
+	passResult.allocationsMoved = pass->statistics.allocationsMoved;
+	passResult.bytesMoved = pass->statistics.bytesMoved;
+	passResult.blocksFreed = pass->statistics.deviceMemoryBlocksFreed;
+	passResult.bytesFreed = pass->statistics.bytesFreed;
+
+	if (passResult.allocationsMoved == 0u)
+	{
+		m_backoffMultiplier = std::min(m_backoffMultiplier * 2u, m_config.maxBackoffMultiplier);
+		m_framesUntilNextCheck = m_config.frameInterval * m_backoffMultiplier;
+
+		return;
+	}
+
+	m_backoffMultiplier = 1u;
+	m_framesUntilNextCheck = m_config.frameInterval;
+	m_completedPass = passResult;
+}
+
+void BufferDefragmenter::RecordPass(const Renderer& renderer, const Config& config, Pass& pass, VkCommandBuffer commandBuffer)
+{
+	PROFILE_SCOPE("BufferDefragmenter::RecordPass");
+
+	if (pass.isEnded)
+	{
+		return;
+	}
+
+	const VulkanContext& vulkanContext = renderer.GetVulkanContext();
+
+	std::vector<VmaAllocation> allocations;
+	allocations.reserve(pass.buffers.size());
+
+	for (const Buffer* const buffer : pass.buffers)
+	{
+		allocations.push_back(buffer->GetAllocation());
+	}
+
+	pass.allocationsChanged.assign(allocations.size(), VK_FALSE);
+
+	VmaDefragmentationInfo2 defragmentationInfo{ };
+	defragmentationInfo.allocationCount = static_cast<std::uint32_t>(allocations.size());
+	defragmentationInfo.pAllocations = allocations.data();
+	defragmentationInfo.pAllocationsChanged = pass.allocationsChanged.data();
+	defragmentationInfo.maxCpuBytesToMove = 0u;
+	defragmentationInfo.maxCpuAllocationsToMove = 0u;
+	defragmentationInfo.maxGpuBytesToMove = config.maxBytesPerPass;
+	defragmentationInfo.maxGpuAllocationsToMove = config.maxAllocationsPerPass;
+	defragmentationInfo.commandBuffer = commandBuffer;
+
+	const VkResult defragmentationResult = vmaDefragmentationBegin(vulkanContext.GetAllocator(), &defragmentationInfo, &pass.statistics, &pass.context);
+	pass.isRecorded = true;
+
+	// VMA holds the affected memory blocks until the pass ends, so a pass that recorded no moves is ended straight away.
+	if ((defragmentationResult != VK_SUCCESS && defragmentationResult != VK_NOT_READY) || pass.statistics.allocationsMoved == 0u)
+	{
+		EndPass(vulkanContext.GetAllocator(), pass);
+
+		if (defragmentationResult != VK_SUCCESS && defragmentationResult != VK_NOT_READY)
+		{
+			throw std::runtime_error("Failed to defragment Vulkan buffer memory.");
+		}
+	}
+}
+
+void BufferDefragmenter::EndPass(const VmaAllocator allocator, Pass& pass) noexcept
+{
+	if (pass.isEnded)
+	{
+		return;
+	}
+
+	vmaDefragmentationEnd(allocator, pass.context);
+	pass.isEnded = true;
+}
+
+[[nodiscard]] std::uint32_t BufferDefragmenter::GetMemoryTypeBits(const std::vector<Buffer*>& buffers) const
+{
+	std::uint32_t memoryTypeBits = 0u;
+
+	for (const Buffer* const buffer : buffers)
+	{
+		VmaAllocationInfo allocationInfo{ };
+		vmaGetAllocationInfo(m_renderer.GetVulkanContext().GetAllocator(), buffer->GetAllocation(), &allocationInfo);
+
+		memoryTypeBits |= 1u << allocationInfo.memoryType;
+	}
+
+	return memoryTypeBits;
+}
+
+[[nodiscard]] BufferDefragmenter::FragmentationStatistics BufferDefragmenter::GetFragmentationStatistics(const std::uint32_t memoryTypeBits) const
+{
+	VmaStats allocatorStatistics{ };
+	vmaCalculateStats(m_renderer.GetVulkanContext().GetAllocator(), &allocatorStatistics);
+
+	FragmentationStatistics fragmentationStatistics{ };
+
+	for (std::uint32_t i = 0; i < VK_MAX_MEMORY_TYPES; ++i)
+	{
+		if (!(memoryTypeBits & (1u << i)))
+		{
+			continue;
+		}
+
+		const VmaStatInfo& memoryTypeStatistics = allocatorStatistics.memoryType[i];
+
+		fragmentationStatistics.blockCount += memoryTypeStatistics.blockCount;
+		fragmentationStatistics.allocationCount += memoryTypeStatistics.allocationCount;
+		fragmentationStatistics.usedBytes += memoryTypeStatistics.usedBytes;
+		fragmentationStatistics.unusedBytes += memoryTypeStatistics.unusedBytes;
+		fragmentationStatistics.unusedRangeCount += memoryTypeStatistics.unusedRangeCount;
+
+		if (memoryTypeStatistics.unusedRangeCount > 0u)
+		{
+			fragmentationStatistics.largestUnusedRange = std::max(fragmentationStatistics.largestUnusedRange, memoryTypeStatistics.unusedRangeSizeMax);
+		}
+	}
+
+	return fragmentationStatistics;
+}
+
+void BufferDefragmenter::Print(std::ostream& outputStream, const PassResult& passResult)
+{
+	constexpr double BytesPerMebibyte = 1'024.0 * 1'024.0;
+
+	outputStream << std::fixed << std::setprecision(2);
+	outputStream << "Defragmented " << passResult.allocationsMoved << " buffers (" << static_cast<double>(passResult.bytesMoved) / BytesPerMebibyte << " MiB moved, "
+		<< passResult.blocksFreed << " blocks and " << static_cast<double>(passResult.bytesFreed) / BytesPerMebibyte << " MiB freed); fragmentation "
+		<< passResult.before.GetFragmentation() * 100.0f << "% -> " << passResult.after.GetFragmentation() * 100.0f << "%, largest free range "
+		<< static_cast<double>(passResult.before.largestUnusedRange) / BytesPerMebibyte << " -> " << static_cast<double>(passResult.after.largestUnusedRange) / BytesPerMebibyte << " MiB, "
+		<< passResult.before.blockCount << " -> " << passResult.after.blockCount << " blocks.\n";
+	outputStream << std::defaultfloat;
+}
\ No newline at end of file
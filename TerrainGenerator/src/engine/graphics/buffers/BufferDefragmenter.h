@@ -0,0 +1,103 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+#include <vma/vk_mem_alloc.h>
+#include <vulkan/vulkan.h>
+
+#include "Buffer.h"
+
+class BufferDefragmenter
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Config
+	{
+		std::uint32_t frameInterval = 120u;
+		float fragmentationThreshold = 0.25f;
+		VkDeviceSize minUnusedBytes = 8u * 1'024u * 1'024u;
+
+		VkDeviceSize maxBytesPerPass = 4u * 1'024u * 1'024u;
+		std::uint32_t maxAllocationsPerPass = 64u;
+
+		std::uint32_t maxBackoffMultiplier = 16u;
+	};
+
+	struct FragmentationStatistics
+	{
+		std::uint32_t blockCount = 0u;
+		std::uint32_t allocationCount = 0u;
+		VkDeviceSize usedBytes = 0u;
+		VkDeviceSize unusedBytes = 0u;
+		std::uint32_t unusedRangeCount = 0u;
+		VkDeviceSize largestUnusedRange = 0u;
+
+		[[nodiscard]] float GetFragmentation() const noexcept;
+	};
+
+	struct PassResult
+	{
+		FragmentationStatistics before{ };
+		FragmentationStatistics after{ };
+
+		std::uint32_t allocationsMoved = 0u;
+		VkDeviceSize bytesMoved = 0u;
+		std::uint32_t blocksFreed = 0u;
+		VkDeviceSize bytesFreed = 0u;
+	};
+
+private:
+	struct Pass
+	{
+		std::vector<Buffer*> buffers;
+		std::uint32_t memoryTypeBits = 0u;
+
+		FragmentationStatistics before{ };
+		VmaDefragmentationContext context = VK_NULL_HANDLE;
+		VmaDefragmentationStats statistics{ };
+		std::vector<VkBool32> allocationsChanged;
+
+		bool isRecorded = false;
+		bool isCompletionDeferred = false;
+		bool isEnded = false;
+	};
+
+	class Renderer& m_renderer;
+	Config m_config;
+
+	std::uint32_t m_framesUntilNextCheck = 0u;
+	std::uint32_t m_backoffMultiplier = 1u;
+	std::shared_ptr<Pass> m_activePass = nullptr;
+	std::optional<PassResult> m_completedPass = std::nullopt;
+
+public:
+	BufferDefragmenter(class Renderer& renderer);
+	BufferDefragmenter(class Renderer& renderer, const Config& config);
+	~BufferDefragmenter() noexcept = default;
+
+	std::optional<PassResult> Update(const std::function<std::vector<Buffer*>()>& getBuffers);
+	void Postpone() noexcept;
+	void Finish();
+
+	inline bool IsPassInProgress() const noexcept { return m_activePass != nullptr; }
+
+	static void Print(std::ostream& outputStream, const PassResult& passResult);
+
+private:
+	void BeginPass(const std::vector<Buffer*>& buffers, const std::uint32_t memoryTypeBits, const FragmentationStatistics& fragmentationStatistics);
+	void CompletePass();
+
+	static void RecordPass(const class Renderer& renderer, const Config& config, Pass& pass, VkCommandBuffer commandBuffer);
+	static void EndPass(const VmaAllocator allocator, Pass& pass) noexcept;
+
+	[[nodiscard]] std::uint32_t GetMemoryTypeBits(const std::vector<Buffer*>& buffers) const;
+	[[nodiscard]] FragmentationStatistics GetFragmentationStatistics(const std::uint32_t memoryTypeBits) const;
+};
\ No newline at end of file
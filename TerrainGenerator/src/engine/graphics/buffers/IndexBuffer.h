@@ -17,8 +17,8 @@ public:
 	IndexBuffer(const class Renderer& renderer);
 	~IndexBuffer() noexcept = default;
 	
-	template <typename T>
-	void Initialise(const std::vector<T>& bufferData)
+	template <typename T, typename Allocator>
+	void Initialise(const std::vector<T, Allocator>& bufferData)
 	{
 		m_indexCount = static_cast<std::uint32_t>(bufferData.size());
 
@@ -0,0 +1,57 @@
+#include "IndirectBuffer.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "../renderer/Renderer.h"
+#include "../renderer/VulkanUtility.h"
+
+IndirectBuffer::IndirectBuffer(const Renderer& renderer)
+	: m_renderer(renderer)
+{ }
+
+IndirectBuffer::~IndirectBuffer() noexcept
+{
+	Destroy();
+}
+
+void IndirectBuffer::Initialise(const std::uint32_t commandCount, const std::uint32_t regionCount)
+{
+	m_commandCount = commandCount;
+	m_regionCount = regionCount;
+
+	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), GetRegionOffset(m_regionCount), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU, MemoryTracker::Category::IndirectBuffers, m_bufferHandle, m_allocation);
+
+	void* commandData = nullptr;
+
+	if (vmaMapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation, &commandData) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to map Vulkan indirect buffer memory.");
+	}
+
+	m_mappedCommands = reinterpret_cast<VkDrawIndexedIndirectCommand*>(commandData);
+}
+
+void IndirectBuffer::Destroy() noexcept
+{
+	if (m_bufferHandle != VK_NULL_HANDLE)
+	{
+		vmaUnmapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation);
+		m_mappedCommands = nullptr;
+
+		vulkan_util::DestroyBuffer(m_renderer.GetVulkanContext(), m_bufferHandle, m_allocation);
+
+		m_commandCount = 0;
+		m_regionCount = 0;
+	}
+}
+
+[[nodiscard]] VkDrawIndexedIndirectCommand* IndirectBuffer::GetRegionCommands(const std::uint32_t regionIndex) const
+{
+	return m_mappedCommands + static_cast<std::size_t>(regionIndex) * m_commandCount;
+}
+
+void IndirectBuffer::FlushRegion(const std::uint32_t regionIndex) const
+{
+	vmaFlushAllocation(m_renderer.GetVulkanContext().GetAllocator(), m_allocation, GetRegionOffset(regionIndex), static_cast<VkDeviceSize>(m_commandCount) * sizeof(VkDrawIndexedIndirectCommand));
+}
\ No newline at end of file
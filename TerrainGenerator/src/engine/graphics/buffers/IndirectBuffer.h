@@ -0,0 +1,40 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <cstdint>
+
+#include <vma/vk_mem_alloc.h>
+#include <vulkan/vulkan.h>
+
+class IndirectBuffer
+	: private INoncopyable, private INonmovable
+{
+private:
+	const class Renderer& m_renderer;
+
+	VkBuffer m_bufferHandle = VK_NULL_HANDLE;
+	VmaAllocation m_allocation = VK_NULL_HANDLE;
+
+	VkDrawIndexedIndirectCommand* m_mappedCommands = nullptr;
+
+	std::uint32_t m_commandCount = 0;
+	std::uint32_t m_regionCount = 0;
+
+public:
+	IndirectBuffer(const class Renderer& renderer);
+	~IndirectBuffer() noexcept;
+
+	void Initialise(const std::uint32_t commandCount, const std::uint32_t regionCount);
+	void Destroy() noexcept;
+
+	[[nodiscard]] VkDrawIndexedIndirectCommand* GetRegionCommands(const std::uint32_t regionIndex) const;
+	void FlushRegion(const std::uint32_t regionIndex) const;
+
+	inline VkDeviceSize GetRegionOffset(const std::uint32_t regionIndex) const noexcept { return static_cast<VkDeviceSize>(regionIndex) * m_commandCount * sizeof(VkDrawIndexedIndirectCommand); }
+
+	inline VkBuffer GetHandle() const noexcept { return m_bufferHandle; }
+	inline std::uint32_t GetCommandCount() const noexcept { return m_commandCount; }
+	inline std::uint32_t GetRegionCount() const noexcept { return m_regionCount; }
+};
\ No newline at end of file
@@ -0,0 +1,5 @@
+#include "StorageBuffer.h"
+
+StorageBuffer::StorageBuffer(const class Renderer& renderer)
+	: Buffer(renderer)
+{ }
\ No newline at end of file
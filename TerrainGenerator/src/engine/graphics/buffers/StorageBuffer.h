@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Buffer.h"
+
+#include <cstdint>
+#include <vector>
+
+class StorageBuffer
+	: public Buffer
+{
+private:
+	std::uint32_t m_elementCount = 0;
+	VkDeviceSize m_size = 0;
+
+public:
+	StorageBuffer(const class Renderer& renderer);
+	~StorageBuffer() noexcept = default;
+
+	template <typename T, typename Allocator>
+	void Initialise(const std::vector<T, Allocator>& bufferData)
+	{
+		m_elementCount = static_cast<std::uint32_t>(bufferData.size());
+		m_size = sizeof(T) * bufferData.size();
+
+		Create(bufferData.data(), m_size, Usage::Storage);
+	}
+
+	inline std::uint32_t GetElementCount() const noexcept { return m_elementCount; }
+	inline VkDeviceSize GetSize() const noexcept { return m_size; }
+};
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "UniformBuffer.h"
 
 #include <cstring>
+#include <stdexcept>
 
 #include "../renderer/Renderer.h"
 #include "../renderer/VulkanUtility.h"
@@ -23,26 +24,31 @@ void UniformBuffer::Initialise(const VkDeviceSize size)
 
 void UniformBuffer::SetBufferData(const void* bufferData, const std::size_t size, const VkDeviceSize offset)
 {
-	void* uniformData = nullptr;
-
-	vmaMapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation, &uniformData);
-	{
-		std::memcpy(reinterpret_cast<void*>(reinterpret_cast<std::byte*>(uniformData) + offset), bufferData, size);
-	}
-	vmaUnmapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation);
+	std::memcpy(m_mappedData + offset, bufferData, size);
+	vmaFlushAllocation(m_renderer.GetVulkanContext().GetAllocator(), m_allocation, offset, size);
 }
 
 void UniformBuffer::Destroy() noexcept
 {
 	if (m_bufferHandle != VK_NULL_HANDLE)
 	{
-		vmaDestroyBuffer(m_renderer.GetVulkanContext().GetAllocator(), m_bufferHandle, m_allocation);
-		m_bufferHandle = VK_NULL_HANDLE;
-		m_allocation = VK_NULL_HANDLE;
+		vmaUnmapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation);
+		m_mappedData = nullptr;
+
+		vulkan_util::DestroyBuffer(m_renderer.GetVulkanContext(), m_bufferHandle, m_allocation);
 	}
 }
 
 void UniformBuffer::Create()
 {
-	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), m_bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_ONLY, m_bufferHandle, m_allocation);
+	vulkan_util::CreateBuffer(m_renderer.GetVulkanContext(), m_bufferSize, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, VMA_MEMORY_USAGE_CPU_TO_GPU, MemoryTracker::Category::UniformBuffers, m_bufferHandle, m_allocation);
+
+	void* uniformData = nullptr;
+
+	if (vmaMapMemory(m_renderer.GetVulkanContext().GetAllocator(), m_allocation, &uniformData) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to map Vulkan uniform buffer memory.");
+	}
+
+	m_mappedData = reinterpret_cast<std::byte*>(uniformData);
 }
\ No newline at end of file
@@ -17,6 +17,7 @@ private:
 	VkBuffer m_bufferHandle = VK_NULL_HANDLE;
 	VmaAllocation m_allocation = VK_NULL_HANDLE;
 
+	std::byte* m_mappedData = nullptr;
 	VkDeviceSize m_bufferSize = 0;
 
 public:
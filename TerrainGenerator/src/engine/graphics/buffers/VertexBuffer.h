@@ -15,8 +15,8 @@ public:
 	VertexBuffer(const class Renderer& renderer);
 	~VertexBuffer() noexcept = default;
 
-	template <typename T>
-	void Initialise(const std::vector<T>& bufferData)
+	template <typename T, typename Allocator>
+	void Initialise(const std::vector<T, Allocator>& bufferData)
 	{
 		m_vertexCount = static_cast<std::uint32_t>(bufferData.size());
 		Create(bufferData.data(), sizeof(T) * bufferData.size(), Usage::Vertex);
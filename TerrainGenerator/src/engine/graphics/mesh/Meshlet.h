@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+struct Meshlet
+{
+	std::uint32_t firstIndex;
+	std::uint32_t indexCount;
+
+	std::uint32_t vertexOffset;
+	std::uint32_t vertexCount;
+	std::uint32_t triangleOffset;
+	std::uint32_t triangleCount;
+
+	glm::vec3 boundingSphereCentre;
+	float boundingSphereRadius;
+
+	glm::vec3 coneApex;
+	glm::vec3 coneAxis;
+	float coneCutoff;
+};
+
+struct MeshletData
+{
+	std::vector<Meshlet> meshlets;
+
+	std::vector<std::uint32_t> vertices;
+	std::vector<std::uint8_t> triangles;
+};
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include "MeshletBuilder.h"
+
+#include <algorithm>
+#include <limits>
+
+[[nodiscard]] MeshletData MeshletBuilder::Build(const std::vector<glm::vec3>& positions, const std::vector<std::uint32_t>& indices)
+{
+	constexpr std::uint32_t NoMeshlet = std::numeric_limits<std::uint32_t>::max();
+
+	MeshletData meshletData;
+	std::vector<std::uint32_t> vertexMeshletIDs(positions.size(), NoMeshlet);
+	std::vector<std::uint8_t> localVertexIndices(positions.size(), 0u);
+
+	Meshlet currentMeshlet{ };
+
+	for (std::size_t i = 0; i + 2 < indices.size(); i += 3)
+	{
+		const std::uint32_t currentMeshletID = static_cast<std::uint32_t>(meshletData.meshlets.size());
+		std::size_t newVertexCount = 0;
+
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			if (vertexMeshletIDs[indices[i + j]] != currentMeshletID)
+			{
+				++newVertexCount;
+			}
+		}
+
+		if (currentMeshlet.vertexCount + newVertexCount > s_MaxVertices || currentMeshlet.triangleCount + 1 > s_MaxTriangles)
+		{
+			CalculateBounds(positions, meshletData, currentMeshlet);
+			meshletData.meshlets.push_back(currentMeshlet);
+
+			currentMeshlet = Meshlet{ };
+			currentMeshlet.firstIndex = static_cast<std::uint32_t>(i);
+			currentMeshlet.vertexOffset = static_cast<std::uint32_t>(meshletData.vertices.size());
+			currentMeshlet.triangleOffset = static_cast<std::uint32_t>(meshletData.triangles.size());
+		}
+
+		const std::uint32_t meshletID = static_cast<std::uint32_t>(meshletData.meshlets.size());
+
+		for (std::size_t j = 0; j < 3; ++j)
+		{
+			const std::uint32_t vertexIndex = indices[i + j];
+
+			if (vertexMeshletIDs[vertexIndex] != meshletID)
+			{
+				vertexMeshletIDs[vertexIndex] = meshletID;
+				localVertexIndices[vertexIndex] = static_cast<std::uint8_t>(currentMeshlet.vertexCount);
+
+				meshletData.vertices.push_back(vertexIndex);
+				++currentMeshlet.vertexCount;
+			}
+
+			meshletData.triangles.push_back(localVertexIndices[vertexIndex]);
+		}
+
+		currentMeshlet.indexCount += 3;
+		++currentMeshlet.triangleCount;
+	}
+
+	if (currentMeshlet.indexCount > 0)
+	{
+		CalculateBounds(positions, meshletData, currentMeshlet);
+		meshletData.meshlets.push_back(currentMeshlet);
+	}
+
+	return meshletData;
+}
+
+[[nodiscard]] bool MeshletBuilder::IsBackFacing(const Meshlet& meshlet, const glm::vec3& cameraPosition)
+{
+	if (meshlet.coneCutoff >= 1.0f)
+	{
+		return false;
+	}
+
+	const glm::vec3 apexOffset = meshlet.coneApex - cameraPosition;
+
+	return glm::dot(apexOffset, meshlet.coneAxis) >= meshlet.coneCutoff * glm::length(apexOffset);
+}
+
+void MeshletBuilder::CalculateBounds(const std::vector<glm::vec3>& positions, const MeshletData& meshletData, Meshlet& meshlet)
+{
+	const auto GetLocalPosition = [&positions, &meshletData, &meshlet](const std::uint32_t localVertexIndex) -> const glm::vec3&
+	{
+		return positions[meshletData.vertices[meshlet.vertexOffset + localVertexIndex]];
+	};
+
+	glm::vec3 minExtent{ std::numeric_limits<float>::max() };
+	glm::vec3 maxExtent{ std::numeric_limits<float>::lowest() };
+
+	for (std::uint32_t i = 0; i < meshlet.vertexCount; ++i)
+	{
+		minExtent = glm::min(minExtent, GetLocalPosition(i));
+		maxExtent = glm::max(maxExtent, GetLocalPosition(i));
+	}
+
+	meshlet.boundingSphereCentre = (minExtent + maxExtent) / 2.0f;
+	meshlet.boundingSphereRadius = 0.0f;
+
+	for (std::uint32_t i = 0; i < meshlet.vertexCount; ++i)
+	{
+		meshlet.boundingSphereRadius = std::max(meshlet.boundingSphereRadius, glm::length(GetLocalPosition(i) - meshlet.boundingSphereCentre));
+	}
+
+	// Front faces in the renderer's left-handed world space have an outward normal of (c - a) x (b - a).
+	std::vector<glm::vec3> triangleNormals;
+	triangleNormals.reserve(meshlet.triangleCount);
+
+	glm::vec3 normalSum{ 0.0f };
+
+	for (std::uint32_t i = meshlet.triangleOffset; i < meshlet.triangleOffset + meshlet.triangleCount * 3; i += 3)
+	{
+		const glm::vec3& a = GetLocalPosition(meshletData.triangles[i]);
+		const glm::vec3& b = GetLocalPosition(meshletData.triangles[i + 1]);
+		const glm::vec3& c = GetLocalPosition(meshletData.triangles[i + 2]);
+
+		const glm::vec3 normal = glm::cross(c - a, b - a);
+		const float normalLength = glm::length(normal);
+
+		triangleNormals.push_back(normalLength > 0.0f ? normal / normalLength : glm::vec3{ 0.0f });
+		normalSum += triangleNormals.back();
+	}
+
+	meshlet.coneAxis = glm::length(normalSum) > 0.0f ? glm::normalize(normalSum) : glm::vec3{ 0.0f, 1.0f, 0.0f };
+	meshlet.coneApex = meshlet.boundingSphereCentre;
+	meshlet.coneCutoff = 1.0f;
+
+	float minNormalDot = 1.0f;
+
+	for (const auto& triangleNormal : triangleNormals)
+	{
+		minNormalDot = std::min(minNormalDot, glm::dot(meshlet.coneAxis, triangleNormal));
+	}
+
+	if (minNormalDot <= 0.1f)
+	{
+		return;
+	}
+
+	float maxApexDistance = 0.0f;
+
+	for (std::uint32_t i = meshlet.triangleOffset, triangle = 0; triangle < meshlet.triangleCount; i += 3, ++triangle)
+	{
+		const float centreDistance = glm::dot(meshlet.boundingSphereCentre - GetLocalPosition(meshletData.triangles[i]), triangleNormals[triangle]);
+		const float axisDistance = glm::dot(meshlet.coneAxis, triangleNormals[triangle]);
+
+		maxApexDistance = std::max(maxApexDistance, centreDistance / axisDistance);
+	}
+
+	meshlet.coneApex = meshlet.boundingSphereCentre - meshlet.coneAxis * maxApexDistance;
+	meshlet.coneCutoff = glm::sqrt(1.0f - minNormalDot * minNormalDot);
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "Meshlet.h"
+
+class MeshletBuilder
+{
+private:
+	static constexpr std::size_t s_MaxVertices = 64u;
+	static constexpr std::size_t s_MaxTriangles = 124u;
+
+public:
+	static constexpr std::size_t GetMaxVertices() noexcept { return s_MaxVertices; }
+	static constexpr std::size_t GetMaxTriangles() noexcept { return s_MaxTriangles; }
+
+	template <typename V, typename VertexAllocator, typename I, typename IndexAllocator>
+	[[nodiscard]] static MeshletData Build(const std::vector<V, VertexAllocator>& vertices, const std::vector<I, IndexAllocator>& indices)
+	{
+		std::vector<glm::vec3> positions;
+		positions.reserve(vertices.size());
+
+		for (const auto& vertex : vertices)
+		{
+			positions.push_back(vertex.position);
+		}
+
+		return Build(positions, std::vector<std::uint32_t>(std::cbegin(indices), std::cend(indices)));
+	}
+
+	[[nodiscard]] static MeshletData Build(const std::vector<glm::vec3>& positions, const std::vector<std::uint32_t>& indices);
+
+	[[nodiscard]] static bool IsBackFacing(const Meshlet& meshlet, const glm::vec3& cameraPosition);
+
+private:
+	static void CalculateBounds(const std::vector<glm::vec3>& positions, const MeshletData& meshletData, Meshlet& meshlet);
+};
\ No newline at end of file
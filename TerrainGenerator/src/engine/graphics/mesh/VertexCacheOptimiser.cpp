@@ -0,0 +1,233 @@
+#include "VertexCacheOptimiser.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+[[nodiscard]] std::vector<std::uint32_t> VertexCacheOptimiser::OptimiseIndices(const std::vector<std::uint32_t>& indices, const std::size_t vertexCount)
+{
+	struct VertexData
+	{
+		int cachePosition = -1;
+		float score = 0.0f;
+
+		std::uint32_t remainingTriangleCount = 0;
+		std::uint32_t triangleListOffset = 0;
+	};
+
+	constexpr std::size_t NoTriangle = std::numeric_limits<std::size_t>::max();
+
+	const std::size_t triangleCount = indices.size() / 3;
+
+	std::vector<VertexData> vertices(vertexCount);
+
+	for (const auto index : indices)
+	{
+		++vertices[index].remainingTriangleCount;
+	}
+
+	std::uint32_t currentOffset = 0;
+
+	for (auto& vertex : vertices)
+	{
+		vertex.triangleListOffset = currentOffset;
+		currentOffset += vertex.remainingTriangleCount;
+		vertex.remainingTriangleCount = 0;
+	}
+
+	std::vector<std::uint32_t> vertexTriangles(indices.size());
+
+	for (std::size_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			VertexData& vertex = vertices[indices[triangle * 3 + i]];
+			vertexTriangles[vertex.triangleListOffset + vertex.remainingTriangleCount] = static_cast<std::uint32_t>(triangle);
+			++vertex.remainingTriangleCount;
+		}
+	}
+
+	for (auto& vertex : vertices)
+	{
+		vertex.score = GetVertexScore(vertex.cachePosition, vertex.remainingTriangleCount);
+	}
+
+	std::vector<float> triangleScores(triangleCount, 0.0f);
+	std::vector<bool> isTriangleEmitted(triangleCount, false);
+
+	for (std::size_t triangle = 0; triangle < triangleCount; ++triangle)
+	{
+		triangleScores[triangle] = vertices[indices[triangle * 3]].score + vertices[indices[triangle * 3 + 1]].score + vertices[indices[triangle * 3 + 2]].score;
+	}
+
+	std::vector<std::uint32_t> optimisedIndices;
+	optimisedIndices.reserve(indices.size());
+
+	std::vector<std::uint32_t> cache;
+	cache.reserve(s_OptimisationCacheSize + 3);
+
+	std::vector<std::uint32_t> updatedCache;
+	updatedCache.reserve(s_OptimisationCacheSize + 3);
+
+	std::size_t nextTriangle = triangleCount > 0 ? 0 : NoTriangle;
+	std::size_t fallbackCursor = 0;
+
+	while (nextTriangle != NoTriangle)
+	{
+		isTriangleEmitted[nextTriangle] = true;
+
+		const std::uint32_t* const triangleIndices = indices.data() + nextTriangle * 3;
+		updatedCache.assign(triangleIndices, triangleIndices + 3);
+
+		for (const auto index : updatedCache)
+		{
+			optimisedIndices.push_back(index);
+
+			VertexData& vertex = vertices[index];
+			const auto triangleListBegin = std::begin(vertexTriangles) + vertex.triangleListOffset;
+			const auto triangleListEnd = triangleListBegin + vertex.remainingTriangleCount;
+
+			std::iter_swap(std::find(triangleListBegin, triangleListEnd, static_cast<std::uint32_t>(nextTriangle)), triangleListEnd - 1);
+			--vertex.remainingTriangleCount;
+		}
+
+		for (const auto index : cache)
+		{
+			if (index != triangleIndices[0] && index != triangleIndices[1] && index != triangleIndices[2])
+			{
+				updatedCache.push_back(index);
+			}
+		}
+
+		for (std::size_t i = 0; i < updatedCache.size(); ++i)
+		{
+			VertexData& vertex = vertices[updatedCache[i]];
+
+			vertex.cachePosition = i < s_OptimisationCacheSize ? static_cast<int>(i) : -1;
+			vertex.score = GetVertexScore(vertex.cachePosition, vertex.remainingTriangleCount);
+		}
+
+		nextTriangle = NoTriangle;
+		float bestScore = -1.0f;
+
+		for (const auto index : updatedCache)
+		{
+			const VertexData& vertex = vertices[index];
+
+			for (std::uint32_t i = 0; i < vertex.remainingTriangleCount; ++i)
+			{
+				const std::uint32_t triangle = vertexTriangles[vertex.triangleListOffset + i];
+				triangleScores[triangle] = vertices[indices[triangle * 3]].score + vertices[indices[triangle * 3 + 1]].score + vertices[indices[triangle * 3 + 2]].score;
+
+				if (triangleScores[triangle] > bestScore)
+				{
+					bestScore = triangleScores[triangle];
+					nextTriangle = triangle;
+				}
+			}
+		}
+
+		if (updatedCache.size() > s_OptimisationCacheSize)
+		{
+			updatedCache.resize(s_OptimisationCacheSize);
+		}
+
+		std::swap(cache, updatedCache);
+
+		if (nextTriangle == NoTriangle)
+		{
+			while (fallbackCursor < triangleCount && isTriangleEmitted[fallbackCursor])
+			{
+				++fallbackCursor;
+			}
+
+			if (fallbackCursor < triangleCount)
+			{
+				nextTriangle = fallbackCursor;
+			}
+		}
+	}
+
+	return optimisedIndices;
+}
+
+[[nodiscard]] VertexCacheOptimiser::Statistics VertexCacheOptimiser::AnalyseIndices(const std::vector<std::uint32_t>& indices, const std::size_t vertexCount, const std::size_t cacheSize)
+{
+	constexpr std::size_t NotCached = std::numeric_limits<std::size_t>::max();
+
+	std::vector<std::size_t> vertexCacheInsertionTimes(vertexCount, NotCached);
+
+	std::size_t cacheMissCount = 0;
+	std::size_t referencedVertexCount = 0;
+
+	for (const auto index : indices)
+	{
+		if (vertexCacheInsertionTimes[index] == NotCached)
+		{
+			++referencedVertexCount;
+		}
+
+		if (vertexCacheInsertionTimes[index] == NotCached || cacheMissCount - vertexCacheInsertionTimes[index] > cacheSize)
+		{
+			vertexCacheInsertionTimes[index] = cacheMissCount;
+			++cacheMissCount;
+		}
+	}
+
+	Statistics statistics{ };
+
+	if (indices.size() >= 3)
+	{
+		statistics.averageCacheMissRatio = static_cast<float>(cacheMissCount) / static_cast<float>(indices.size() / 3);
+	}
+
+	if (referencedVertexCount > 0)
+	{
+		statistics.averageTransformToVertexRatio = static_cast<float>(cacheMissCount) / static_cast<float>(referencedVertexCount);
+	}
+
+	return statistics;
+}
+
+[[nodiscard]] float VertexCacheOptimiser::GetVertexScore(const int cachePosition, const std::uint32_t remainingTriangleCount)
+{
+	constexpr float CacheDecayPower = 1.5f;
+	constexpr float LastTriangleScore = 0.75f;
+	constexpr float ValenceBoostScale = 2.0f;
+	constexpr float ValenceBoostPower = 0.5f;
+
+	static const std::array<float, s_OptimisationCacheSize> cacheScores = []()
+	{
+		std::array<float, s_OptimisationCacheSize> scores{ };
+
+		for (std::size_t i = 0; i < scores.size(); ++i)
+		{
+			scores[i] = i < 3 ? LastTriangleScore : std::pow(1.0f - static_cast<float>(i - 3) / static_cast<float>(s_OptimisationCacheSize - 3), CacheDecayPower);
+		}
+
+		return scores;
+	}();
+
+	static const std::array<float, s_MaxPrecomputedValence + 1> valenceScores = []()
+	{
+		std::array<float, s_MaxPrecomputedValence + 1> scores{ };
+
+		for (std::size_t i = 1; i < scores.size(); ++i)
+		{
+			scores[i] = ValenceBoostScale * std::pow(static_cast<float>(i), -ValenceBoostPower);
+		}
+
+		return scores;
+	}();
+
+	if (remainingTriangleCount == 0)
+	{
+		return -1.0f;
+	}
+
+	const float cacheScore = cachePosition >= 0 ? cacheScores[cachePosition] : 0.0f;
+	const float valenceScore = remainingTriangleCount <= s_MaxPrecomputedValence ? valenceScores[remainingTriangleCount] : ValenceBoostScale * std::pow(static_cast<float>(remainingTriangleCount), -ValenceBoostPower);
+
+	return cacheScore + valenceScore;
+}
\ No newline at end of file
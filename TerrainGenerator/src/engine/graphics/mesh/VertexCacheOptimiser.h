@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+class VertexCacheOptimiser
+{
+public:
+	struct Statistics
+	{
+		float averageCacheMissRatio = 0.0f;
+		float averageTransformToVertexRatio = 0.0f;
+	};
+
+private:
+	static constexpr std::size_t s_OptimisationCacheSize = 32u;
+	static constexpr std::size_t s_MaxPrecomputedValence = 32u;
+	static constexpr std::size_t s_DefaultAnalysisCacheSize = 16u;
+
+public:
+	static constexpr std::size_t GetDefaultAnalysisCacheSize() noexcept { return s_DefaultAnalysisCacheSize; }
+
+	template <typename T, typename Allocator>
+	static void Optimise(std::vector<T, Allocator>& indices, const std::size_t vertexCount)
+	{
+		const std::vector<std::uint32_t> optimisedIndices = OptimiseIndices(std::vector<std::uint32_t>(std::cbegin(indices), std::cend(indices)), vertexCount);
+
+		for (std::size_t i = 0; i < indices.size(); ++i)
+		{
+			indices[i] = static_cast<T>(optimisedIndices[i]);
+		}
+	}
+
+	template <typename T, typename Allocator>
+	[[nodiscard]] static Statistics Analyse(const std::vector<T, Allocator>& indices, const std::size_t vertexCount, const std::size_t cacheSize = s_DefaultAnalysisCacheSize)
+	{
+		return AnalyseIndices(std::vector<std::uint32_t>(std::cbegin(indices), std::cend(indices)), vertexCount, cacheSize);
+	}
+
+private:
+	[[nodiscard]] static std::vector<std::uint32_t> OptimiseIndices(const std::vector<std::uint32_t>& indices, const std::size_t vertexCount);
+	[[nodiscard]] static Statistics AnalyseIndices(const std::vector<std::uint32_t>& indices, const std::size_t vertexCount, const std::size_t cacheSize);
+
+	[[nodiscard]] static float GetVertexScore(const int cachePosition, const std::uint32_t remainingTriangleCount);
+};
\ No newline at end of file
@@ -1,27 +1,22 @@
 #include "GraphicsPipeline.h"
 
+#include <algorithm>
 #include <array>
 #include <iterator>
-#include <set>
 #include <stdexcept>
+#include <utility>
 
 #include "../renderer/Renderer.h"
+#include "../../utility/Profiler.h"
 
 GraphicsPipeline::GraphicsPipeline(const Renderer& renderer, const Config& config)
-	: m_renderer(renderer)
-{
-	if (s_minOffsetAlignment == std::numeric_limits<VkDeviceSize>::max() || s_maxPushConstantBufferSize == 0)
-	{
-		VkPhysicalDeviceProperties physicalDeviceProperties{ };
-		vkGetPhysicalDeviceProperties(m_renderer.GetVulkanContext().GetPhysicalDevice(), &physicalDeviceProperties);
-
-		s_minOffsetAlignment = physicalDeviceProperties.limits.minUniformBufferOffsetAlignment;
-		s_maxPushConstantBufferSize = physicalDeviceProperties.limits.maxPushConstantsSize;
-	}
+	: GraphicsPipeline(renderer, std::make_shared<ShaderProgram>(renderer, config.shaderInfo, config.shaderArchive), config)
+{ }
 
+GraphicsPipeline::GraphicsPipeline(const Renderer& renderer, std::shared_ptr<ShaderProgram> shaderProgram, const Config& config)
+	: m_renderer(renderer), m_shaderProgram(std::move(shaderProgram))
+{
 	InitialisePipeline(config);
-	InitialiseDescriptorPool();
-	InitialiseUniformBuffers();
 }
 
 GraphicsPipeline::~GraphicsPipeline() noexcept
@@ -31,408 +26,86 @@ GraphicsPipeline::~GraphicsPipeline() noexcept
 
 void GraphicsPipeline::Destroy() noexcept
 {
-	DestroyUniformBuffers();
-	DestroyDescriptorPool();
-
 	DestroyPipeline();
+	m_shaderProgram = nullptr;
 }
 
-void GraphicsPipeline::RefreshUniformBuffers()
-{
-	m_renderer.GetVulkanContext().WaitOnGraphicsQueue();
-	m_renderer.GetVulkanContext().WaitOnPresentationQueue();
-
-	DestroyDescriptorPool();
-	InitialiseDescriptorPool();
-
-	InitialiseUniformBuffers();
-}
-
-std::uint32_t GraphicsPipeline::GetVertexInputSize(const spirv_cross::SPIRType& vertexInputType)
+[[nodiscard]] std::vector<GraphicsPipeline::SpecialisationData> GraphicsPipeline::GetSpecialisationData(const Config& config) const
 {
-	std::uint32_t size = vertexInputType.vecsize;
-
-	switch (vertexInputType.basetype)
-	{
-	case spirv_cross::SPIRType::BaseType::Boolean:
-		break;
-
-	case spirv_cross::SPIRType::BaseType::Half:
-		size *= 2;
+	std::vector<SpecialisationData> specialisationData(m_shaderProgram->GetShaderModules().size());
 
-		break;
-
-	case spirv_cross::SPIRType::BaseType::Int:
-	case spirv_cross::SPIRType::BaseType::UInt:
-	case spirv_cross::SPIRType::BaseType::Float:
-		size *= 4;
-
-		break;
-
-	case spirv_cross::SPIRType::BaseType::Double:
-		size *= 8;
-
-		break;
-
-	default:
-		return 0;
-	}
-
-	return size;
-}
-
-VkFormat GraphicsPipeline::GetVertexInputFormat(const spirv_cross::SPIRType& vertexInputType)
-{
-	switch (vertexInputType.vecsize)
+	for (std::size_t i = 0; i < specialisationData.size(); ++i)
 	{
-	case 1:
-		switch (vertexInputType.basetype)
-		{
-		case spirv_cross::SPIRType::BaseType::Boolean:
-			return VK_FORMAT_R8_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Half:
-			return VK_FORMAT_R16_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Int:
-			return VK_FORMAT_R32_SINT;
-
-		case spirv_cross::SPIRType::BaseType::UInt:
-			return VK_FORMAT_R32_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Float:
-			return VK_FORMAT_R32_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Double:
-			return VK_FORMAT_R64_SFLOAT;
-
-		default:
-			break;
-		}
-
-		break;
-
-	case 2:
-		switch (vertexInputType.basetype)
-		{
-		case spirv_cross::SPIRType::BaseType::Boolean:
-			return VK_FORMAT_R8G8_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Half:
-			return VK_FORMAT_R16G16_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Int:
-			return VK_FORMAT_R32G32_SINT;
-
-		case spirv_cross::SPIRType::BaseType::UInt:
-			return VK_FORMAT_R32G32_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Float:
-			return VK_FORMAT_R32G32_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Double:
-			return VK_FORMAT_R64G64_SFLOAT;
-
-		default:
-			break;
-		}
-
-		break;
-
-	case 3:
-		switch (vertexInputType.basetype)
-		{
-		case spirv_cross::SPIRType::BaseType::Boolean:
-			return VK_FORMAT_R8G8B8_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Half:
-			return VK_FORMAT_R16G16B16_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Int:
-			return VK_FORMAT_R32G32B32_SINT;
-
-		case spirv_cross::SPIRType::BaseType::UInt:
-			return VK_FORMAT_R32G32B32_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Float:
-			return VK_FORMAT_R32G32B32_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Double:
-			return VK_FORMAT_R64G64B64_SFLOAT;
-
-		default:
-			break;
-		}
-
-		break;
-
-	case 4:
-		switch (vertexInputType.basetype)
-		{
-		case spirv_cross::SPIRType::BaseType::Boolean:
-			return VK_FORMAT_R8G8B8A8_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Half:
-			return VK_FORMAT_R16G16B16A16_SFLOAT;
+		const ShaderModule& shaderModule = *m_shaderProgram->GetShaderModules()[i];
+		const auto stageConstantsLocation = config.specialisationConstants.find(shaderModule.GetStage());
 
-		case spirv_cross::SPIRType::BaseType::Int:
-			return VK_FORMAT_R32G32B32A32_SINT;
-
-		case spirv_cross::SPIRType::BaseType::UInt:
-			return VK_FORMAT_R32G32B32A32_UINT;
-
-		case spirv_cross::SPIRType::BaseType::Float:
-			return VK_FORMAT_R32G32B32A32_SFLOAT;
-
-		case spirv_cross::SPIRType::BaseType::Double:
-			return VK_FORMAT_R64G64B64A64_SFLOAT;
-
-		default:
-			break;
-		}
-
-		break;
-
-	default:
-		break;
-	}
-
-	return VK_FORMAT_UNDEFINED;
-}
-
-std::pair<VkVertexInputBindingDescription, std::vector<VkVertexInputAttributeDescription>> GraphicsPipeline::GetVertexInputData(const std::vector<std::unique_ptr<ShaderModule>>& shaderModules)
-{
-	std::set<VertexInputData> vertexInputs;
-
-	for (const auto& shaderModule : shaderModules)
-	{
-		if (shaderModule->GetStage() == ShaderModule::Stage::Vertex)
+		if (stageConstantsLocation == std::cend(config.specialisationConstants))
 		{
-			const spirv_cross::ShaderResources shaderResources = shaderModule->GetDataReflector()->get_shader_resources();
-			for (const auto& shaderInput : shaderResources.stage_inputs)
-			{
-				const spirv_cross::SPIRType type = shaderModule->GetDataReflector()->get_type(shaderInput.base_type_id);
-
-				const VertexInputData currentVertexInput{
-					.location = shaderModule->GetDataReflector()->get_decoration(shaderInput.id, spv::Decoration::DecorationLocation),
-					.size = GetVertexInputSize(type),
-					.format = GetVertexInputFormat(type)
-				};
-
-				if (currentVertexInput.format == VK_FORMAT_UNDEFINED)
-				{
-					throw std::runtime_error("Invalid vertex input type in Vulkan shader.");
-				}
-
-				vertexInputs.insert(currentVertexInput);
-			}
-
-			break;
+			continue;
 		}
-	}
-
-	VkVertexInputBindingDescription vertexInputBindingDescription{ };
-	vertexInputBindingDescription.binding = 0;
-	vertexInputBindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
-	vertexInputBindingDescription.stride = 0;
-
-	std::vector<VkVertexInputAttributeDescription> vertexInputAttributeDescriptions(vertexInputs.size());
-	std::size_t currentAttributeDescriptionIndex = 0;
-
-	for (const auto vertexInput : vertexInputs)
-	{
-		vertexInputAttributeDescriptions[currentAttributeDescriptionIndex] = VkVertexInputAttributeDescription{ };
-		vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].binding = 0;
-		vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].location = vertexInput.location;
-		vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].format = vertexInput.format;
-		vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].offset = vertexInputBindingDescription.stride;
-
-		vertexInputBindingDescription.stride += vertexInput.size;
-
-		++currentAttributeDescriptionIndex;
-	}
 
-	return { vertexInputBindingDescription, vertexInputAttributeDescriptions };
-}
-
-void GraphicsPipeline::InitialiseDescriptorSetLayouts(const Config& config, const std::vector<std::unique_ptr<ShaderModule>>& shaderModules)
-{
-	for (const auto& shaderModule : shaderModules)
-	{
-		const spirv_cross::ShaderResources shaderResources = shaderModule->GetDataReflector()->get_shader_resources();
-
-		for (const auto& uniform : shaderResources.uniform_buffers)
-		{
-			if (const std::uint32_t set = shaderModule->GetDataReflector()->get_decoration(uniform.id, spv::Decoration::DecorationDescriptorSet);
-				set != 0)
-			{
-				throw std::runtime_error("Vulkan descriptor sets with an ID other than zero are not supported by this renderer.");
-			}
-
-			const std::uint32_t binding = shaderModule->GetDataReflector()->get_decoration(uniform.id, spv::Decoration::DecorationBinding);
-			std::size_t size = shaderModule->GetDataReflector()->get_declared_struct_size(shaderModule->GetDataReflector()->get_type(uniform.base_type_id));
-			size += s_minOffsetAlignment - (size % s_minOffsetAlignment);
-
-			if (m_bindingsData.find(binding) == std::cend(m_bindingsData))
-			{
-				const DescriptorSetBindingData currentBindingData{
-					.size = static_cast<std::uint32_t>(size),
-					.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
-					.shaderStages = static_cast<VkShaderStageFlags>(shaderModule->GetStage())
-				};
-
-				m_bindingsData[binding] = currentBindingData;
-			}
-			else
-			{
-				m_bindingsData[binding].shaderStages |= static_cast<VkShaderStageFlags>(shaderModule->GetStage());
-			}
-		}
+		const auto& reflectedConstants = shaderModule.GetReflectionData().specialisationConstants;
 
-		for (const auto& sampler : shaderResources.sampled_images)
+		for (const auto& [name, value] : stageConstantsLocation->second)
 		{
-			if (const std::uint32_t set = shaderModule->GetDataReflector()->get_decoration(sampler.id, spv::Decoration::DecorationDescriptorSet);
-				set != 0)
-			{
-				throw std::runtime_error("Vulkan descriptor sets with an ID other than zero are not supported by this renderer.");
-			}
-
-			const std::uint32_t binding = shaderModule->GetDataReflector()->get_decoration(sampler.id, spv::Decoration::DecorationBinding);
-
-			if (m_bindingsData.find(binding) == std::cend(m_bindingsData))
-			{
-				const DescriptorSetBindingData currentBindingData{
-					.size = std::nullopt,
-					.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
-					.shaderStages = static_cast<VkShaderStageFlags>(shaderModule->GetStage())
-				};
+			const auto reflectedConstantLocation = std::ranges::find(reflectedConstants, name, &ShaderReflectionData::SpecialisationConstant::name);
 
-				m_bindingsData[binding] = currentBindingData;
-			}
-			else
+			if (reflectedConstantLocation == std::cend(reflectedConstants))
 			{
-				m_bindingsData[binding].shaderStages |= static_cast<VkShaderStageFlags>(shaderModule->GetStage());
+				continue;
 			}
-		}
 
-		for (const auto& pushConstant : shaderResources.push_constant_buffers)
-		{
-			if (m_pushConstantRange.stageFlags == 0)
+			if (reflectedConstantLocation->size != sizeof(std::uint32_t))
 			{
-				m_pushConstantRange.stageFlags = static_cast<VkShaderStageFlags>(shaderModule->GetStage());
-				m_pushConstantRange.size = static_cast<std::uint32_t>(shaderModule->GetDataReflector()->get_declared_struct_size(shaderModule->GetDataReflector()->get_type(pushConstant.base_type_id)));
-				m_pushConstantRange.offset = 0;
-
-				if (m_pushConstantRange.size > s_maxPushConstantBufferSize)
-				{
-					throw std::runtime_error("Push constant buffer is too large in Vulkan shader.");
-				}
+				throw std::runtime_error("Specialisation constant " + name + " is not 32 bits wide.");
 			}
-			else
-			{
-				m_pushConstantRange.stageFlags = static_cast<VkShaderStageFlags>(shaderModule->GetStage());
-			}
-		}
-	}
 
-	std::vector<VkDescriptorSetLayoutBinding> descriptorSetLayoutBindings(m_bindingsData.size());
-	std::size_t currentDescriptorSetLayoutBindingsIndex = 0;
+			specialisationData[i].mapEntries.push_back(VkSpecializationMapEntry{
+				.constantID = reflectedConstantLocation->constantID,
+				.offset = static_cast<std::uint32_t>(specialisationData[i].values.size() * sizeof(std::uint32_t)),
+				.size = sizeof(std::uint32_t)
+			});
 
-	for (const auto& [binding, bindingData] : m_bindingsData)
-	{
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex] = VkDescriptorSetLayoutBinding{ };
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex].binding = binding;
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex].descriptorType = bindingData.type;
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex].descriptorCount = 1;
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex].stageFlags = bindingData.shaderStages;
-		descriptorSetLayoutBindings[currentDescriptorSetLayoutBindingsIndex].pImmutableSamplers = nullptr;
-
-		if (m_descriptorTypeCounts.find(bindingData.type) == std::cend(m_descriptorTypeCounts))
-		{
-			m_descriptorTypeCounts[bindingData.type] = 0;
+			specialisationData[i].values.push_back(value);
 		}
-
-		++m_descriptorTypeCounts[bindingData.type];
-		++currentDescriptorSetLayoutBindingsIndex;
-	}
-
-	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{ };
-	descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-	descriptorSetLayoutCreateInfo.bindingCount = static_cast<std::uint32_t>(descriptorSetLayoutBindings.size());
-	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings.data();
-
-	if (vkCreateDescriptorSetLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorSetLayoutCreateInfo, nullptr, &m_descriptorSetLayout) != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to create Vulkan descriptor set layout.");
-	}
-}
-
-void GraphicsPipeline::DestroyDescriptorSetLayout() noexcept
-{
-	if (m_descriptorSetLayout != VK_NULL_HANDLE)
-	{
-		vkDestroyDescriptorSetLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), m_descriptorSetLayout, nullptr);
-		m_descriptorSetLayout = VK_NULL_HANDLE;
-	}
-}
-
-void GraphicsPipeline::InitialisePipelineLayout(const Config& config, const std::vector<std::unique_ptr<ShaderModule>>& shaderModules)
-{
-	InitialiseDescriptorSetLayouts(config, shaderModules);
-
-	VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{ };
-	pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
-	pipelineLayoutCreateInfo.setLayoutCount = 1;
-	pipelineLayoutCreateInfo.pSetLayouts = &m_descriptorSetLayout;
-	pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
-	pipelineLayoutCreateInfo.pPushConstantRanges = &m_pushConstantRange;
-
-	if (vkCreatePipelineLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), &pipelineLayoutCreateInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to create Vulkan pipeline layout.");
-	}
-}
-
-void GraphicsPipeline::DestroyPipelineLayout() noexcept
-{
-	if (m_pipelineLayout != VK_NULL_HANDLE)
-	{
-		vkDestroyPipelineLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), m_pipelineLayout, nullptr);
-		m_pipelineLayout = VK_NULL_HANDLE;
 	}
 
-	DestroyDescriptorSetLayout();
+	return specialisationData;
 }
 
 void GraphicsPipeline::InitialisePipeline(const Config& config)
 {
-	std::vector<std::unique_ptr<ShaderModule>> shaderModules;
-	shaderModules.reserve(config.shaderInfo.size());
+	const std::vector<SpecialisationData> specialisationData = GetSpecialisationData(config);
 
-	std::vector<VkPipelineShaderStageCreateInfo> shaderStageCreateInfos;
-	shaderStageCreateInfos.reserve(config.shaderInfo.size());
+	std::vector<VkPipelineShaderStageCreateInfo> shaderStageCreateInfos = m_shaderProgram->GetShaderStageCreateInfos();
+	std::vector<VkSpecializationInfo> specialisationInfos(shaderStageCreateInfos.size());
 
-	for (const auto& [shaderFilepath, shaderType] : config.shaderInfo)
+	for (std::size_t i = 0; i < shaderStageCreateInfos.size(); ++i)
 	{
-		shaderModules.emplace_back(std::make_unique<ShaderModule>(m_renderer.GetVulkanContext().GetLogicalDevice(), shaderFilepath, shaderType));
-		shaderStageCreateInfos.push_back(shaderModules.back()->GetCreateInfo());
-	}
+		if (specialisationData[i].mapEntries.empty())
+		{
+			continue;
+		}
 
-	InitialisePipelineLayout(config, shaderModules);
+		specialisationInfos[i].mapEntryCount = static_cast<std::uint32_t>(specialisationData[i].mapEntries.size());
+		specialisationInfos[i].pMapEntries = specialisationData[i].mapEntries.data();
+		specialisationInfos[i].dataSize = specialisationData[i].values.size() * sizeof(std::uint32_t);
+		specialisationInfos[i].pData = specialisationData[i].values.data();
 
-	const auto [vertexInputBindingDescription, vertexInputAttributeDescriptions] = GetVertexInputData(shaderModules);
+		shaderStageCreateInfos[i].pSpecializationInfo = &specialisationInfos[i];
+	}
 
 	VkPipelineVertexInputStateCreateInfo vertexInputStateCreateInfo{ };
 	vertexInputStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO;
 	vertexInputStateCreateInfo.vertexBindingDescriptionCount = 1;
-	vertexInputStateCreateInfo.pVertexBindingDescriptions = &vertexInputBindingDescription;
-	vertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<std::uint32_t>(vertexInputAttributeDescriptions.size());
-	vertexInputStateCreateInfo.pVertexAttributeDescriptions = vertexInputAttributeDescriptions.data();
+	vertexInputStateCreateInfo.pVertexBindingDescriptions = &m_shaderProgram->GetVertexInputBindingDescription();
+	vertexInputStateCreateInfo.vertexAttributeDescriptionCount = static_cast<std::uint32_t>(m_shaderProgram->GetVertexInputAttributeDescriptions().size());
+	vertexInputStateCreateInfo.pVertexAttributeDescriptions = m_shaderProgram->GetVertexInputAttributeDescriptions().data();
 
 	VkPipelineInputAssemblyStateCreateInfo inputAssemblyStateCreateInfo{ };
 	inputAssemblyStateCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO;
-	inputAssemblyStateCreateInfo.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-	inputAssemblyStateCreateInfo.primitiveRestartEnable = VK_FALSE;
+	inputAssemblyStateCreateInfo.topology = config.topology;
+	inputAssemblyStateCreateInfo.primitiveRestartEnable = config.enablePrimitiveRestart ? VK_TRUE : VK_FALSE;
 
 	VkViewport viewport{ };
 	viewport.x = 0.0f;
@@ -553,13 +226,15 @@ void GraphicsPipeline::InitialisePipeline(const Config& config)
 	graphicsPipelineCreateInfo.pDepthStencilState = &depthStencilStateCreateInfo;
 	graphicsPipelineCreateInfo.pColorBlendState = &colourBlendStateCreateInfo;
 	graphicsPipelineCreateInfo.pDynamicState = &dynamicStateCreateInfo;
-	graphicsPipelineCreateInfo.layout = m_pipelineLayout;
+	graphicsPipelineCreateInfo.layout = m_shaderProgram->GetLayout();
 	graphicsPipelineCreateInfo.renderPass = m_renderer.GetRenderPass();
 	graphicsPipelineCreateInfo.subpass = 0;
 	graphicsPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
 	graphicsPipelineCreateInfo.basePipelineIndex = -1;
 
-	if (vkCreateGraphicsPipelines(m_renderer.GetVulkanContext().GetLogicalDevice(), VK_NULL_HANDLE, 1, &graphicsPipelineCreateInfo, nullptr, &m_pipelineHandle) != VK_SUCCESS)
+	PROFILE_SCOPE(m_renderer.HasWarmPipelineCache() ? "vkCreateGraphicsPipelines (warm cache)" : "vkCreateGraphicsPipelines (cold cache)");
+
+	if (vkCreateGraphicsPipelines(m_renderer.GetVulkanContext().GetLogicalDevice(), m_renderer.GetPipelineCache(), 1, &graphicsPipelineCreateInfo, nullptr, &m_pipelineHandle) != VK_SUCCESS)
 	{
 		throw std::runtime_error("Failed to create Vulkan graphics pipeline.");
 	}
@@ -572,173 +247,4 @@ void GraphicsPipeline::DestroyPipeline() noexcept
 		vkDestroyPipeline(m_renderer.GetVulkanContext().GetLogicalDevice(), m_pipelineHandle, nullptr);
 		m_pipelineHandle = VK_NULL_HANDLE;
 	}
-
-	DestroyPipelineLayout();
-}
-
-void GraphicsPipeline::InitialiseDescriptorPool()
-{
-	std::vector<VkDescriptorPoolSize> poolSizes(m_descriptorTypeCounts.size());
-	std::size_t poolSizeIndex = 0;
-
-	for (const auto [type, count] : m_descriptorTypeCounts)
-	{
-		poolSizes[poolSizeIndex].type = type;
-		poolSizes[poolSizeIndex].descriptorCount = count * m_renderer.GetSwapchainImageCount();
-
-		++poolSizeIndex;
-	}
-
-	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo{ };
-	descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-	descriptorPoolCreateInfo.poolSizeCount = static_cast<std::uint32_t>(poolSizes.size());
-	descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
-	descriptorPoolCreateInfo.maxSets = m_renderer.GetSwapchainImageCount();
-
-	if (vkCreateDescriptorPool(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorPoolCreateInfo, nullptr, &m_descriptorPool) != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to create Vulkan descriptor pool.");
-	}
-}
-
-void GraphicsPipeline::DestroyDescriptorPool() noexcept
-{
-	if (m_descriptorPool != VK_NULL_HANDLE)
-	{
-		vkDestroyDescriptorPool(m_renderer.GetVulkanContext().GetLogicalDevice(), m_descriptorPool, nullptr);
-		m_descriptorPool = VK_NULL_HANDLE;
-
-		m_descriptorSets.clear();
-	}
-}
-
-void GraphicsPipeline::InitialiseUniformBuffers()
-{
-	ResizeUniformBuffers();
-
-	for (std::size_t i = 0; i < m_renderer.GetSwapchainImageCount(); ++i)
-	{
-		std::size_t currentUniformBufferSize = 0;
-
-		for (const auto& [binding, bindingData] : m_bindingsData)
-		{
-			if (bindingData.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
-			{
-				continue;
-			}
-
-			currentUniformBufferSize += bindingData.size.value();
-		}
-
-		m_uniformBuffers[i]->Initialise(currentUniformBufferSize);
-	}
-
-	InitialiseDescriptorSets();
-}
-
-void GraphicsPipeline::ResizeUniformBuffers()
-{
-	DestroyUniformBuffers();
-	m_uniformBuffers.resize(m_renderer.GetSwapchainImageCount());
-	
-	for (auto& uniformBuffer : m_uniformBuffers)
-	{
-		uniformBuffer = std::make_unique<UniformBuffer>(m_renderer);
-	}
-}
-
-void GraphicsPipeline::DestroyUniformBuffers() noexcept
-{
-	if (!m_uniformBuffers.empty())
-	{
-		m_uniformBuffers.clear();
-	}
-}
-
-void GraphicsPipeline::InitialiseDescriptorSets()
-{
-	m_descriptorSets.resize(m_renderer.GetSwapchainImageCount());
-
-	VkDeviceSize currentOffset = 0;
-	const std::vector<VkDescriptorSetLayout> currentLayouts(m_renderer.GetSwapchainImageCount(), m_descriptorSetLayout);
-
-	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { };
-	descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-	descriptorSetAllocateInfo.descriptorPool = m_descriptorPool;
-	descriptorSetAllocateInfo.descriptorSetCount = static_cast<std::uint32_t>(m_renderer.GetSwapchainImageCount());
-	descriptorSetAllocateInfo.pSetLayouts = currentLayouts.data();
-
-	if (vkAllocateDescriptorSets(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorSetAllocateInfo, m_descriptorSets.data()) != VK_SUCCESS)
-	{
-		throw std::runtime_error("Failed to allocate Vulkan descriptor sets.");
-	}
-
-	for (std::size_t i = 0; i < m_renderer.GetSwapchainImageCount(); ++i)
-	{
-		for (const auto& [binding, bindingData] : m_bindingsData)
-		{
-			VkDescriptorBufferInfo descriptorBufferInfo{ };
-			VkDescriptorImageInfo descriptorImageInfo{ };
-
-			if (bindingData.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
-			{
-				descriptorBufferInfo.buffer = m_uniformBuffers[i]->GetHandle();
-				descriptorBufferInfo.offset = currentOffset;
-				descriptorBufferInfo.range = bindingData.size.value();
-
-				currentOffset += bindingData.size.value();
-			}
-			else if (bindingData.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
-			{
-				descriptorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
-				descriptorImageInfo.imageView = VK_NULL_HANDLE;
-				descriptorImageInfo.sampler = VK_NULL_HANDLE;
-			}
-
-			VkWriteDescriptorSet writeDescriptorSet{ };
-			writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			writeDescriptorSet.dstSet = m_descriptorSets[i];
-			writeDescriptorSet.dstBinding = binding;
-			writeDescriptorSet.dstArrayElement = 0;
-			writeDescriptorSet.descriptorType = bindingData.type;
-			writeDescriptorSet.descriptorCount = 1;
-
-			if (bindingData.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
-			{
-				writeDescriptorSet.pBufferInfo = &descriptorBufferInfo;
-				writeDescriptorSet.pImageInfo = nullptr;
-				writeDescriptorSet.pTexelBufferView = nullptr;
-			}
-			else if (bindingData.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
-			{
-				writeDescriptorSet.pBufferInfo = nullptr;
-				writeDescriptorSet.pImageInfo = &descriptorImageInfo;
-				writeDescriptorSet.pTexelBufferView = nullptr;
-			}
-
-			vkUpdateDescriptorSets(m_renderer.GetVulkanContext().GetLogicalDevice(), 1, &writeDescriptorSet, 0, nullptr);
-		}
-
-		currentOffset = 0;
-	}
-}
-
-void GraphicsPipeline::SetUniformBufferData(const std::uint32_t updatedBinding, const void* data)
-{
-	VkDeviceSize offset = 0;
-	std::size_t size = 0;
-
-	for (const auto& [binding, bindingData] : m_bindingsData)
-	{
-		if (binding == updatedBinding)
-		{
-			size = bindingData.size.value();
-
-			break;
-		}
-
-		offset += bindingData.size.value();
-	}
-
-	m_uniformBuffers[m_renderer.GetNextAcquiredImageIndex()]->SetBufferData(data, size, offset);
 }
\ No newline at end of file
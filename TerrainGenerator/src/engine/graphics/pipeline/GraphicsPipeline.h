@@ -3,22 +3,18 @@
 #include "../../utility/interfaces/INoncopyable.h"
 #include "../../utility/interfaces/INonmovable.h"
 
-#include <cstddef>
 #include <cstdint>
-#include <limits>
 #include <map>
 #include <memory>
-#include <optional>
 #include <string>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include <spirv-cross/spirv_cross.hpp>
 #include <vulkan/vulkan.h>
 
-#include "../buffers/UniformBuffer.h"
+#include "ShaderArchive.h"
 #include "ShaderModule.h"
+#include "ShaderProgram.h"
 
 class GraphicsPipeline
 	: private INoncopyable, private INonmovable
@@ -27,93 +23,76 @@ public:
 	struct Config
 	{
 		std::vector<std::pair<std::string, ShaderModule::Stage>> shaderInfo;
+		const ShaderArchive* shaderArchive = nullptr;
+		std::map<ShaderModule::Stage, std::map<std::string, std::uint32_t>> specialisationConstants;
+
+		VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+		bool enablePrimitiveRestart = false;
 
 		bool enableDepthTest = true;
 		bool drawWireframe = false;
 		bool enableCullFace = true;
 		bool enableBlending = true;
-	};
 
-private:
-	struct VertexInputData
-	{
-		std::uint32_t location;
-
-		std::uint32_t size;
-		VkFormat format;
-
-		inline bool operator <(const VertexInputData& other) const noexcept { return this->location < other.location; }
+		bool operator ==(const Config& other) const = default;
 	};
 
-	struct DescriptorSetBindingData
+private:
+	struct SpecialisationData
 	{
-		std::optional<std::uint32_t> size;
-		VkDescriptorType type;
-		VkShaderStageFlags shaderStages;
+		std::vector<VkSpecializationMapEntry> mapEntries;
+		std::vector<std::uint32_t> values;
 	};
 
-	inline static VkDeviceSize s_minOffsetAlignment = std::numeric_limits<VkDeviceSize>::max();
-	inline static std::uint32_t s_maxPushConstantBufferSize = 0;
-
 	const class Renderer& m_renderer;
 
+	std::shared_ptr<ShaderProgram> m_shaderProgram = nullptr;
 	VkPipeline m_pipelineHandle = VK_NULL_HANDLE;
 
-	VkDescriptorSetLayout m_descriptorSetLayout = VK_NULL_HANDLE;
-	VkPushConstantRange m_pushConstantRange{ };
-	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
-
-	VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
-
-	std::vector<std::unique_ptr<UniformBuffer>> m_uniformBuffers;
-	std::vector<VkDescriptorSet> m_descriptorSets;
-
-	std::map<std::uint32_t, DescriptorSetBindingData> m_bindingsData;
-	std::unordered_map<VkDescriptorType, std::uint32_t> m_descriptorTypeCounts;
-
 public:
 	GraphicsPipeline(const class Renderer& renderer, const Config& config);
+	GraphicsPipeline(const class Renderer& renderer, std::shared_ptr<ShaderProgram> shaderProgram, const Config& config);
 	~GraphicsPipeline() noexcept;
 	
 	void Destroy() noexcept;
 	
-	void RefreshUniformBuffers();
+	inline void RefreshUniformBuffers() { m_shaderProgram->RefreshUniformBuffers(); }
 
 	template <typename T>
-	inline void SetUniform(const std::uint32_t binding, const T& data)
+	inline void SetUniform(const std::uint32_t binding, const T& data, const std::uint32_t blockIndex = 0)
 	{
-		SetUniformBufferData(binding, &data);
+		m_shaderProgram->SetUniform(binding, data, blockIndex);
 	}
 
-	inline VkPipeline GetHandle() const noexcept { return m_pipelineHandle; }
-	inline VkPipelineLayout GetLayout() const noexcept { return m_pipelineLayout; }
-	inline const std::vector<VkDescriptorSet>& GetDescriptorSets() const noexcept { return m_descriptorSets; }
-
-	inline VkShaderStageFlags GetPushConstantStageFlags() const noexcept { return m_pushConstantRange.stageFlags; }
+	inline void SetStorageBuffer(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkBuffer buffer, const VkDeviceSize offset = 0, const VkDeviceSize range = VK_WHOLE_SIZE)
+	{
+		m_shaderProgram->SetStorageBuffer(set, binding, arrayElement, buffer, offset, range);
+	}
 
-private:
-	static std::uint32_t GetVertexInputSize(const spirv_cross::SPIRType& vertexInputType);
-	static VkFormat GetVertexInputFormat(const spirv_cross::SPIRType& vertexInputType);
+	inline void SetImage(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkImageView imageView, const VkSampler sampler = VK_NULL_HANDLE)
+	{
+		m_shaderProgram->SetImage(set, binding, arrayElement, imageView, sampler);
+	}
 
-	std::pair< VkVertexInputBindingDescription, std::vector<VkVertexInputAttributeDescription>> GetVertexInputData(const std::vector<std::unique_ptr<ShaderModule>>& shaderModules);
+	[[nodiscard]] inline std::uint32_t GetUniformBlockOffset(const std::uint32_t frameIndex, const std::uint32_t blockIndex) const { return m_shaderProgram->GetUniformBlockOffset(frameIndex, blockIndex); }
 
-	void InitialiseDescriptorSetLayouts(const Config& config, const std::vector<std::unique_ptr<ShaderModule>>& shaderModules);
-	void DestroyDescriptorSetLayout() noexcept;
+	static constexpr std::uint32_t GetUniformBlocksPerFrame() noexcept { return ShaderProgram::GetUniformBlocksPerFrame(); }
+	static constexpr std::uint32_t GetMaxDynamicOffsetCount() noexcept { return ShaderProgram::GetMaxDynamicOffsetCount(); }
 
-	void InitialisePipelineLayout(const Config& config, const std::vector<std::unique_ptr<ShaderModule>>& shaderModules);
-	void DestroyPipelineLayout() noexcept;
+	inline VkPipeline GetHandle() const noexcept { return m_pipelineHandle; }
+	inline const std::shared_ptr<ShaderProgram>& GetShaderProgram() const noexcept { return m_shaderProgram; }
 
-	void InitialisePipeline(const Config& config);
-	void DestroyPipeline() noexcept;
+	inline VkPipelineLayout GetLayout() const noexcept { return m_shaderProgram->GetLayout(); }
+	[[nodiscard]] inline std::uint32_t GetDescriptorCount(const std::uint32_t set, const std::uint32_t binding) const { return m_shaderProgram->GetDescriptorCount(set, binding); }
 
-	void InitialiseDescriptorPool();
-	void DestroyDescriptorPool() noexcept;
+	inline const std::vector<VkDescriptorSet>& GetDescriptorSets() const noexcept { return m_shaderProgram->GetDescriptorSets(); }
+	inline std::uint32_t GetDynamicOffsetCount() const noexcept { return m_shaderProgram->GetDynamicOffsetCount(); }
 
-	void InitialiseUniformBuffers();
-	void ResizeUniformBuffers();
-	void DestroyUniformBuffers() noexcept;
+	inline VkShaderStageFlags GetPushConstantStageFlags() const noexcept { return m_shaderProgram->GetPushConstantStageFlags(); }
 
-	void InitialiseDescriptorSets();
+private:
+	[[nodiscard]] std::vector<SpecialisationData> GetSpecialisationData(const Config& config) const;
 
-	void SetUniformBufferData(const std::uint32_t updatedBinding, const void* data);
+	void InitialisePipeline(const Config& config);
+	void DestroyPipeline() noexcept;
 };
\ No newline at end of file
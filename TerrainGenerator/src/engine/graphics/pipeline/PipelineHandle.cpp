@@ -0,0 +1,37 @@
+#include "PipelineHandle.h"
+
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+PipelineHandle::PipelineHandle(std::shared_future<std::shared_ptr<GraphicsPipeline>> pipeline)
+	: m_pipeline(std::move(pipeline))
+{ }
+
+[[nodiscard]] bool PipelineHandle::IsReady() const
+{
+	return IsValid() && m_pipeline.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+[[nodiscard]] GraphicsPipeline* PipelineHandle::TryGet() const
+{
+	return IsReady() ? m_pipeline.get().get() : nullptr;
+}
+
+[[nodiscard]] GraphicsPipeline& PipelineHandle::Get() const
+{
+	if (!IsValid())
+	{
+		throw std::runtime_error("Attempted to access an empty pipeline handle.");
+	}
+
+	return *m_pipeline.get();
+}
+
+void PipelineHandle::Wait() const
+{
+	if (IsValid())
+	{
+		m_pipeline.wait();
+	}
+}
\ No newline at end of file
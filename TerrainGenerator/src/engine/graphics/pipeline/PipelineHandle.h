@@ -0,0 +1,23 @@
+#pragma once
+
+#include <future>
+#include <memory>
+
+#include "GraphicsPipeline.h"
+
+class PipelineHandle
+{
+private:
+	std::shared_future<std::shared_ptr<GraphicsPipeline>> m_pipeline;
+
+public:
+	PipelineHandle() = default;
+	explicit PipelineHandle(std::shared_future<std::shared_ptr<GraphicsPipeline>> pipeline);
+
+	[[nodiscard]] bool IsReady() const;
+	[[nodiscard]] GraphicsPipeline* TryGet() const;
+	[[nodiscard]] GraphicsPipeline& Get() const;
+	void Wait() const;
+
+	inline bool IsValid() const noexcept { return m_pipeline.valid(); }
+};
\ No newline at end of file
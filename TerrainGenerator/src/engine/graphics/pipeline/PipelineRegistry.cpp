@@ -0,0 +1,148 @@
+#include "PipelineRegistry.h"
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+namespace
+{
+	template <typename T>
+	void CombineHash(std::size_t& seed, const T& value) noexcept
+	{
+		seed ^= std::hash<T>{ }(value) + 0x9E3779B9u + (seed << 6) + (seed >> 2);
+	}
+}
+
+[[nodiscard]] std::size_t PipelineRegistry::ConfigHash::operator ()(const GraphicsPipeline::Config& config) const noexcept
+{
+	std::size_t seed = 0;
+
+	for (const auto& [shaderFilepath, shaderStage] : config.shaderInfo)
+	{
+		CombineHash(seed, shaderFilepath);
+		CombineHash(seed, static_cast<std::underlying_type_t<ShaderModule::Stage>>(shaderStage));
+	}
+
+	CombineHash(seed, config.shaderArchive);
+
+	for (const auto& [shaderStage, specialisationConstants] : config.specialisationConstants)
+	{
+		CombineHash(seed, static_cast<std::underlying_type_t<ShaderModule::Stage>>(shaderStage));
+
+		for (const auto& [name, value] : specialisationConstants)
+		{
+			CombineHash(seed, name);
+			CombineHash(seed, value);
+		}
+	}
+
+	CombineHash(seed, static_cast<std::underlying_type_t<VkPrimitiveTopology>>(config.topology));
+	CombineHash(seed, config.enablePrimitiveRestart);
+	CombineHash(seed, config.enableDepthTest);
+	CombineHash(seed, config.drawWireframe);
+	CombineHash(seed, config.enableCullFace);
+	CombineHash(seed, config.enableBlending);
+
+	return seed;
+}
+
+PipelineRegistry::PipelineRegistry(const Renderer& renderer, const std::size_t compilationThreadCount)
+	: m_renderer(renderer), m_compilationThreadPool(compilationThreadCount)
+{ }
+
+PipelineRegistry::~PipelineRegistry() noexcept
+{
+	Destroy();
+}
+
+void PipelineRegistry::Destroy() noexcept
+{
+	const std::scoped_lock lock(m_registryMutex);
+
+	for (const auto& [config, pipeline] : m_pipelines)
+	{
+		pipeline.wait();
+	}
+
+	m_pipelines.clear();
+	m_shaderPrograms.clear();
+}
+
+void PipelineRegistry::Prewarm(const std::vector<GraphicsPipeline::Config>& configs)
+{
+	for (const auto& config : configs)
+	{
+		static_cast<void>(Request(config));
+	}
+}
+
+[[nodiscard]] PipelineHandle PipelineRegistry::Request(const GraphicsPipeline::Config& config)
+{
+	const std::scoped_lock lock(m_registryMutex);
+
+	if (const auto pipelineLocation = m_pipelines.find(config);
+		pipelineLocation != std::cend(m_pipelines))
+	{
+		return PipelineHandle(pipelineLocation->second);
+	}
+
+	std::shared_future<std::shared_ptr<GraphicsPipeline>> pipeline = m_compilationThreadPool.Enqueue([this, config, shaderProgram = GetShaderProgram(config)]()
+	{
+		return std::make_shared<GraphicsPipeline>(m_renderer, shaderProgram, config);
+	}).share();
+
+	m_pipelines[config] = pipeline;
+
+	return PipelineHandle(std::move(pipeline));
+}
+
+[[nodiscard]] GraphicsPipeline& PipelineRegistry::Get(const GraphicsPipeline::Config& config)
+{
+	return Request(config).Get();
+}
+
+[[nodiscard]] bool PipelineRegistry::IsReady(const GraphicsPipeline::Config& config) const
+{
+	const std::scoped_lock lock(m_registryMutex);
+
+	if (const auto pipelineLocation = m_pipelines.find(config);
+		pipelineLocation != std::cend(m_pipelines))
+	{
+		return PipelineHandle(pipelineLocation->second).IsReady();
+	}
+
+	return false;
+}
+
+void PipelineRegistry::WaitForAll() const
+{
+	const std::scoped_lock lock(m_registryMutex);
+
+	for (const auto& [config, pipeline] : m_pipelines)
+	{
+		pipeline.wait();
+	}
+}
+
+[[nodiscard]] std::size_t PipelineRegistry::GetVariantCount() const
+{
+	const std::scoped_lock lock(m_registryMutex);
+
+	return m_pipelines.size();
+}
+
+[[nodiscard]] std::shared_ptr<ShaderProgram> PipelineRegistry::GetShaderProgram(const GraphicsPipeline::Config& config)
+{
+	const ShaderKey shaderKey{ config.shaderInfo, config.shaderArchive };
+
+	if (const auto shaderProgramLocation = m_shaderPrograms.find(shaderKey);
+		shaderProgramLocation != std::cend(m_shaderPrograms))
+	{
+		return shaderProgramLocation->second;
+	}
+
+	std::shared_ptr<ShaderProgram> shaderProgram = std::make_shared<ShaderProgram>(m_renderer, config.shaderInfo, config.shaderArchive);
+	m_shaderPrograms[shaderKey] = shaderProgram;
+
+	return shaderProgram;
+}
\ No newline at end of file
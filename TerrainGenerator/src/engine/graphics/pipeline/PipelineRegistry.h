@@ -0,0 +1,61 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../../utility/ThreadPool.h"
+#include "GraphicsPipeline.h"
+#include "PipelineHandle.h"
+#include "ShaderArchive.h"
+#include "ShaderModule.h"
+#include "ShaderProgram.h"
+
+class PipelineRegistry
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct ConfigHash
+	{
+		[[nodiscard]] std::size_t operator ()(const GraphicsPipeline::Config& config) const noexcept;
+	};
+
+private:
+	using ShaderKey = std::pair<std::vector<std::pair<std::string, ShaderModule::Stage>>, const ShaderArchive*>;
+
+	const class Renderer& m_renderer;
+
+	std::map<ShaderKey, std::shared_ptr<ShaderProgram>> m_shaderPrograms;
+	std::unordered_map<GraphicsPipeline::Config, std::shared_future<std::shared_ptr<GraphicsPipeline>>, ConfigHash> m_pipelines;
+	mutable std::mutex m_registryMutex;
+
+	ThreadPool m_compilationThreadPool;
+
+public:
+	explicit PipelineRegistry(const class Renderer& renderer, const std::size_t compilationThreadCount = std::max(std::thread::hardware_concurrency() / 2u, 1u));
+	~PipelineRegistry() noexcept;
+
+	void Destroy() noexcept;
+
+	void Prewarm(const std::vector<GraphicsPipeline::Config>& configs);
+	[[nodiscard]] PipelineHandle Request(const GraphicsPipeline::Config& config);
+	[[nodiscard]] GraphicsPipeline& Get(const GraphicsPipeline::Config& config);
+	[[nodiscard]] bool IsReady(const GraphicsPipeline::Config& config) const;
+	void WaitForAll() const;
+
+	[[nodiscard]] std::size_t GetVariantCount() const;
+
+private:
+	[[nodiscard]] std::shared_ptr<ShaderProgram> GetShaderProgram(const GraphicsPipeline::Config& config);
+};
\ No newline at end of file
@@ -0,0 +1,243 @@
+#include "ShaderArchive.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <spirv-cross/spirv_cross.hpp>
+
+#include "ShaderModule.h"
+
+void ShaderArchive::Build(const std::string& archiveFilepath, const std::vector<std::string>& shaderFilepaths)
+{
+	std::vector<EntryHeader> entryHeaders(shaderFilepaths.size());
+	std::vector<std::byte> payload;
+
+	const auto appendToPayload = [&payload](const void* data, const std::size_t size) -> std::uint32_t
+	{
+		while (payload.size() % sizeof(std::uint32_t) != 0)
+		{
+			payload.push_back(std::byte{ 0 });
+		}
+
+		const std::size_t offset = payload.size();
+
+		payload.resize(offset + size);
+		std::memcpy(payload.data() + offset, data, size);
+
+		return static_cast<std::uint32_t>(offset);
+	};
+
+	for (std::size_t i = 0; i < shaderFilepaths.size(); ++i)
+	{
+		std::vector<std::uint32_t> spirV = ShaderModule::ReadSpirVFile(shaderFilepaths[i]);
+		const std::vector<std::byte> reflectionData = shader_reflection::Serialise(shader_reflection::Reflect(spirv_cross::Compiler(spirV)));
+
+		entryHeaders[i].nameOffset = appendToPayload(shaderFilepaths[i].data(), shaderFilepaths[i].size());
+		entryHeaders[i].nameSize = static_cast<std::uint32_t>(shaderFilepaths[i].size());
+		entryHeaders[i].spirVOffset = appendToPayload(spirV.data(), spirV.size() * sizeof(std::uint32_t));
+		entryHeaders[i].spirVSize = static_cast<std::uint32_t>(spirV.size() * sizeof(std::uint32_t));
+		entryHeaders[i].reflectionOffset = appendToPayload(reflectionData.data(), reflectionData.size());
+		entryHeaders[i].reflectionSize = static_cast<std::uint32_t>(reflectionData.size());
+	}
+
+	const std::uint32_t payloadOffset = static_cast<std::uint32_t>(sizeof(Header) + sizeof(EntryHeader) * entryHeaders.size());
+
+	for (auto& entryHeader : entryHeaders)
+	{
+		entryHeader.nameOffset += payloadOffset;
+		entryHeader.spirVOffset += payloadOffset;
+		entryHeader.reflectionOffset += payloadOffset;
+	}
+
+	const Header header{
+		.magic = s_Magic,
+		.version = s_Version,
+		.entryCount = static_cast<std::uint32_t>(entryHeaders.size())
+	};
+
+	std::filesystem::path temporaryFilepath(archiveFilepath);
+	temporaryFilepath += ".tmp";
+
+	{
+		std::ofstream archiveFile(temporaryFilepath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+		archiveFile.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+		archiveFile.write(reinterpret_cast<const char*>(entryHeaders.data()), static_cast<std::streamsize>(sizeof(EntryHeader) * entryHeaders.size()));
+		archiveFile.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+		archiveFile.close();
+
+		if (!archiveFile)
+		{
+			std::filesystem::remove(temporaryFilepath);
+
+			throw std::runtime_error("Failed to write shader archive " + archiveFilepath + ".");
+		}
+	}
+
+	std::filesystem::rename(temporaryFilepath, archiveFilepath);
+}
+
+ShaderArchive::ShaderArchive(const std::string& archiveFilepath)
+{
+	Map(archiveFilepath);
+
+	try
+	{
+		ReadEntries();
+	}
+	catch (...)
+	{
+		Unmap();
+
+		throw;
+	}
+}
+
+ShaderArchive::~ShaderArchive() noexcept
+{
+	Unmap();
+}
+
+[[nodiscard]] const ShaderArchive::Entry* ShaderArchive::FindEntry(const std::string& shaderFilepath) const
+{
+	if (const auto entryLocation = m_entries.find(shaderFilepath);
+		entryLocation != std::cend(m_entries))
+	{
+		return &entryLocation->second;
+	}
+
+	return nullptr;
+}
+
+void ShaderArchive::Map(const std::string& archiveFilepath)
+{
+#ifdef _WIN32
+	const HANDLE fileHandle = CreateFileA(archiveFilepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		throw std::runtime_error("Failed to open shader archive " + archiveFilepath + ".");
+	}
+
+	LARGE_INTEGER fileSize{ };
+
+	if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart < static_cast<LONGLONG>(sizeof(Header)))
+	{
+		CloseHandle(fileHandle);
+
+		throw std::runtime_error("Invalid shader archive " + archiveFilepath + ".");
+	}
+
+	const HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(fileHandle);
+
+	if (mappingHandle == nullptr)
+	{
+		throw std::runtime_error("Failed to map shader archive " + archiveFilepath + ".");
+	}
+
+	const void* mappedView = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+	CloseHandle(mappingHandle);
+
+	if (mappedView == nullptr)
+	{
+		throw std::runtime_error("Failed to map shader archive " + archiveFilepath + ".");
+	}
+
+	m_mappedData = static_cast<const std::byte*>(mappedView);
+	m_mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+	const int fileDescriptor = open(archiveFilepath.c_str(), O_RDONLY);
+
+	if (fileDescriptor == -1)
+	{
+		throw std::runtime_error("Failed to open shader archive " + archiveFilepath + ".");
+	}
+
+	struct stat fileStatus{ };
+
+	if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size < static_cast<off_t>(sizeof(Header)))
+	{
+		close(fileDescriptor);
+
+		throw std::runtime_error("Invalid shader archive " + archiveFilepath + ".");
+	}
+
+	void* const mappedView = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+	close(fileDescriptor);
+
+	if (mappedView == MAP_FAILED)
+	{
+		throw std::runtime_error("Failed to map shader archive " + archiveFilepath + ".");
+	}
+
+	m_mappedData = static_cast<const std::byte*>(mappedView);
+	m_mappedSize = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+}
+
+void ShaderArchive::Unmap() noexcept
+{
+	if (m_mappedData != nullptr)
+	{
+#ifdef _WIN32
+		UnmapViewOfFile(m_mappedData);
+#else
+		munmap(const_cast<std::byte*>(m_mappedData), m_mappedSize);
+#endif
+
+		m_mappedData = nullptr;
+		m_mappedSize = 0;
+	}
+
+	m_entries.clear();
+}
+
+void ShaderArchive::ReadEntries()
+{
+	Header header{ };
+	std::memcpy(&header, m_mappedData, sizeof(Header));
+
+	if (header.magic != s_Magic || header.version != s_Version || sizeof(Header) + sizeof(EntryHeader) * static_cast<std::size_t>(header.entryCount) > m_mappedSize)
+	{
+		throw std::runtime_error("Shader archive has an invalid header.");
+	}
+
+	const auto isInBounds = [this](const std::uint32_t offset, const std::uint32_t size)
+	{
+		return static_cast<std::size_t>(offset) + size <= m_mappedSize;
+	};
+
+	for (std::uint32_t i = 0; i < header.entryCount; ++i)
+	{
+		EntryHeader entryHeader{ };
+		std::memcpy(&entryHeader, m_mappedData + sizeof(Header) + sizeof(EntryHeader) * i, sizeof(EntryHeader));
+
+		if (!isInBounds(entryHeader.nameOffset, entryHeader.nameSize) || !isInBounds(entryHeader.spirVOffset, entryHeader.spirVSize) || !isInBounds(entryHeader.reflectionOffset, entryHeader.reflectionSize)
+			|| entryHeader.spirVOffset % sizeof(std::uint32_t) != 0 || entryHeader.spirVSize % sizeof(std::uint32_t) != 0)
+		{
+			throw std::runtime_error("Shader archive has an invalid entry.");
+		}
+
+		std::string name(reinterpret_cast<const char*>(m_mappedData + entryHeader.nameOffset), entryHeader.nameSize);
+
+		m_entries[std::move(name)] = Entry{
+			.spirV = std::span<const std::uint32_t>(reinterpret_cast<const std::uint32_t*>(m_mappedData + entryHeader.spirVOffset), entryHeader.spirVSize / sizeof(std::uint32_t)),
+			.reflectionData = shader_reflection::Deserialise(m_mappedData + entryHeader.reflectionOffset, entryHeader.reflectionSize)
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ShaderReflection.h"
+
+class ShaderArchive
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Entry
+	{
+		std::span<const std::uint32_t> spirV;
+		ShaderReflectionData reflectionData;
+	};
+
+private:
+	struct Header
+	{
+		std::uint32_t magic;
+		std::uint32_t version;
+		std::uint32_t entryCount;
+	};
+
+	struct EntryHeader
+	{
+		std::uint32_t nameOffset;
+		std::uint32_t nameSize;
+
+		std::uint32_t spirVOffset;
+		std::uint32_t spirVSize;
+
+		std::uint32_t reflectionOffset;
+		std::uint32_t reflectionSize;
+	};
+
+	static constexpr std::uint32_t s_Magic = 0x41535354u;
+	static constexpr std::uint32_t s_Version = 3u;
+
+	const std::byte* m_mappedData = nullptr;
+	std::size_t m_mappedSize = 0;
+
+	std::unordered_map<std::string, Entry> m_entries;
+
+public:
+	static void Build(const std::string& archiveFilepath, const std::vector<std::string>& shaderFilepaths);
+
+	explicit ShaderArchive(const std::string& archiveFilepath);
+	~ShaderArchive() noexcept;
+
+	[[nodiscard]] const Entry* FindEntry(const std::string& shaderFilepath) const;
+
+	inline std::size_t GetEntryCount() const noexcept { return m_entries.size(); }
+
+private:
+	void Map(const std::string& archiveFilepath);
+	void Unmap() noexcept;
+
+	void ReadEntries();
+};
\ No newline at end of file
@@ -6,22 +6,40 @@
 #include <unordered_map>
 #include <utility>
 
-ShaderModule::ShaderModule(const VkDevice vulkanDevice, const std::string& shaderFilepath, const Stage stage)
-	: m_vulkanDevice(vulkanDevice), m_stage(stage)
-{
-	std::vector<std::uint32_t> shaderData = ReadSpirVFile(shaderFilepath);
+#include <spirv-cross/spirv_cross.hpp>
 
-	VkShaderModuleCreateInfo shaderModuleCreateInfo{ };
-	shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
-	shaderModuleCreateInfo.codeSize = shaderData.size() * sizeof(std::uint32_t);
-	shaderModuleCreateInfo.pCode = reinterpret_cast<const std::uint32_t*>(shaderData.data());
+[[nodiscard]] std::vector<std::uint32_t> ShaderModule::ReadSpirVFile(const std::string& filepath)
+{
+	std::ifstream shaderFile(filepath, std::ios_base::in | std::ios_base::ate | std::ios_base::binary);
 
-	if (vkCreateShaderModule(m_vulkanDevice, &shaderModuleCreateInfo, nullptr, &m_moduleHandle) != VK_SUCCESS)
+	if (!shaderFile.is_open())
 	{
-		throw std::runtime_error("Failed to create Vulkan shader module.");
+		throw std::runtime_error("Failed to open shader file " + filepath + ".");
 	}
 
-	m_dataReflector = std::make_unique<spirv_cross::CompilerGLSL>(std::move(shaderData));
+	const std::size_t fileSize = static_cast<std::size_t>(shaderFile.tellg());
+	std::vector<std::uint32_t> shaderData(fileSize / sizeof(std::uint32_t));
+
+	shaderFile.seekg(0);
+	shaderFile.read(reinterpret_cast<char*>(shaderData.data()), fileSize);
+	shaderFile.close();
+
+	return shaderData;
+}
+
+ShaderModule::ShaderModule(const VkDevice vulkanDevice, const std::string& shaderFilepath, const Stage stage)
+	: m_vulkanDevice(vulkanDevice), m_stage(stage)
+{
+	const std::vector<std::uint32_t> shaderData = ReadSpirVFile(shaderFilepath);
+
+	m_reflectionData = shader_reflection::Reflect(spirv_cross::Compiler(shaderData));
+	Initialise(shaderData);
+}
+
+ShaderModule::ShaderModule(const VkDevice vulkanDevice, const ShaderArchive::Entry& archiveEntry, const Stage stage)
+	: m_vulkanDevice(vulkanDevice), m_stage(stage), m_reflectionData(archiveEntry.reflectionData)
+{
+	Initialise(archiveEntry.spirV);
 }
 
 ShaderModule::~ShaderModule() noexcept
@@ -41,23 +59,17 @@ ShaderModule::~ShaderModule() noexcept
 	return shaderStageCreateInfo;
 }
 
-[[nodiscard]] std::vector<std::uint32_t> ShaderModule::ReadSpirVFile(const std::string& filepath)
+void ShaderModule::Initialise(const std::span<const std::uint32_t> spirV)
 {
-	std::ifstream shaderFile(filepath, std::ios_base::in | std::ios_base::ate | std::ios_base::binary);
+	VkShaderModuleCreateInfo shaderModuleCreateInfo{ };
+	shaderModuleCreateInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
+	shaderModuleCreateInfo.codeSize = spirV.size_bytes();
+	shaderModuleCreateInfo.pCode = spirV.data();
 
-	if (!shaderFile.is_open())
+	if (vkCreateShaderModule(m_vulkanDevice, &shaderModuleCreateInfo, nullptr, &m_moduleHandle) != VK_SUCCESS)
 	{
-		throw std::runtime_error("Failed to open shader file " + filepath + ".");
+		throw std::runtime_error("Failed to create Vulkan shader module.");
 	}
-
-	const std::size_t fileSize = static_cast<std::size_t>(shaderFile.tellg());
-	std::vector<std::uint32_t> shaderData(fileSize / sizeof(std::uint32_t));
-
-	shaderFile.seekg(0);
-	shaderFile.read(reinterpret_cast<char*>(shaderData.data()), fileSize);
-	shaderFile.close();
-
-	return shaderData;
 }
 
 void ShaderModule::Destroy() noexcept
@@ -67,6 +79,4 @@ void ShaderModule::Destroy() noexcept
 		vkDestroyShaderModule(m_vulkanDevice, m_moduleHandle, nullptr);
 		m_moduleHandle = VK_NULL_HANDLE;
 	}
-
-	m_dataReflector = nullptr;
 }
\ No newline at end of file
@@ -4,14 +4,16 @@
 #include "../../utility/interfaces/INonmovable.h"
 
 #include <cstdint>
-#include <memory>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
 
-#include <spirv-cross/spirv_glsl.hpp>
 #include <vulkan/vulkan.h>
 
+#include "ShaderArchive.h"
+#include "ShaderReflection.h"
+
 class ShaderModule
 	: private INoncopyable, private INonmovable
 {
@@ -34,19 +36,22 @@ private:
 	VkShaderModule m_moduleHandle = VK_NULL_HANDLE;
 	Stage m_stage = Stage::None;
 
-	std::unique_ptr<spirv_cross::CompilerGLSL> m_dataReflector = nullptr;
+	ShaderReflectionData m_reflectionData;
 
 public:
+	[[nodiscard]] static std::vector<std::uint32_t> ReadSpirVFile(const std::string& filepath);
+
 	ShaderModule(const VkDevice vulkanDevice, const std::string& shaderFilepath, const Stage stage);
+	ShaderModule(const VkDevice vulkanDevice, const ShaderArchive::Entry& archiveEntry, const Stage stage);
 	~ShaderModule() noexcept;
 
 	[[nodiscard]] VkPipelineShaderStageCreateInfo GetCreateInfo() const;	
 	
 	inline Stage GetStage() const noexcept { return m_stage; }
-	inline const std::unique_ptr<spirv_cross::CompilerGLSL>& GetDataReflector() const noexcept { return m_dataReflector; }
+	inline const ShaderReflectionData& GetReflectionData() const noexcept { return m_reflectionData; }
 
 private:
-	[[nodiscard]] std::vector<std::uint32_t> ReadSpirVFile(const std::string& filepath);
+	void Initialise(const std::span<const std::uint32_t> spirV);
 
 	void Destroy() noexcept;
 };
\ No newline at end of file
@@ -0,0 +1,602 @@
+#include "ShaderProgram.h"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+
+#include "../renderer/Renderer.h"
+
+ShaderProgram::ShaderProgram(const Renderer& renderer, const std::vector<std::pair<std::string, ShaderModule::Stage>>& shaderInfo, const ShaderArchive* const shaderArchive)
+	: m_renderer(renderer)
+{
+	if (s_minOffsetAlignment == std::numeric_limits<VkDeviceSize>::max() || s_maxPushConstantBufferSize == 0)
+	{
+		VkPhysicalDeviceProperties physicalDeviceProperties{ };
+		vkGetPhysicalDeviceProperties(m_renderer.GetVulkanContext().GetPhysicalDevice(), &physicalDeviceProperties);
+
+		s_minOffsetAlignment = physicalDeviceProperties.limits.minUniformBufferOffsetAlignment;
+		s_maxPushConstantBufferSize = physicalDeviceProperties.limits.maxPushConstantsSize;
+	}
+
+	InitialiseShaderModules(shaderInfo, shaderArchive);
+	InitialiseVertexInputData();
+	InitialisePipelineLayout();
+
+	InitialiseDescriptorPool();
+	InitialiseUniformBuffers();
+}
+
+ShaderProgram::~ShaderProgram() noexcept
+{
+	Destroy();
+}
+
+void ShaderProgram::Destroy() noexcept
+{
+	DestroyUniformBuffers();
+	DestroyDescriptorPool();
+
+	DestroyPipelineLayout();
+	DestroyShaderModules();
+}
+
+void ShaderProgram::RefreshUniformBuffers()
+{
+	m_renderer.GetVulkanContext().WaitOnGraphicsQueue();
+	m_renderer.GetVulkanContext().WaitOnPresentationQueue();
+
+	DestroyDescriptorPool();
+	InitialiseDescriptorPool();
+
+	InitialiseUniformBuffers();
+	m_areDescriptorSetsBound = false;
+}
+
+void ShaderProgram::InitialiseShaderModules(const std::vector<std::pair<std::string, ShaderModule::Stage>>& shaderInfo, const ShaderArchive* const shaderArchive)
+{
+	m_shaderModules.reserve(shaderInfo.size());
+	m_shaderStageCreateInfos.reserve(shaderInfo.size());
+
+	for (const auto& [shaderFilepath, shaderType] : shaderInfo)
+	{
+		if (const ShaderArchive::Entry* const archiveEntry = shaderArchive != nullptr ? shaderArchive->FindEntry(shaderFilepath) : nullptr;
+			archiveEntry != nullptr)
+		{
+			m_shaderModules.emplace_back(std::make_unique<ShaderModule>(m_renderer.GetVulkanContext().GetLogicalDevice(), *archiveEntry, shaderType));
+		}
+		else
+		{
+			m_shaderModules.emplace_back(std::make_unique<ShaderModule>(m_renderer.GetVulkanContext().GetLogicalDevice(), shaderFilepath, shaderType));
+		}
+
+		m_shaderStageCreateInfos.push_back(m_shaderModules.back()->GetCreateInfo());
+	}
+}
+
+void ShaderProgram::DestroyShaderModules() noexcept
+{
+	m_shaderStageCreateInfos.clear();
+	m_shaderModules.clear();
+}
+
+void ShaderProgram::InitialiseVertexInputData()
+{
+	std::set<VertexInputData> vertexInputs;
+
+	for (const auto& shaderModule : m_shaderModules)
+	{
+		if (shaderModule->GetStage() == ShaderModule::Stage::Vertex)
+		{
+			for (const auto& shaderInput : shaderModule->GetReflectionData().vertexInputs)
+			{
+				if (shaderInput.format == VK_FORMAT_UNDEFINED)
+				{
+					throw std::runtime_error("Invalid vertex input type in Vulkan shader.");
+				}
+
+				vertexInputs.insert(VertexInputData{
+					.location = shaderInput.location,
+					.size = shaderInput.size,
+					.format = shaderInput.format
+				});
+			}
+
+			break;
+		}
+	}
+
+	m_vertexInputBindingDescription = VkVertexInputBindingDescription{ };
+	m_vertexInputBindingDescription.binding = 0;
+	m_vertexInputBindingDescription.inputRate = VK_VERTEX_INPUT_RATE_VERTEX;
+	m_vertexInputBindingDescription.stride = 0;
+
+	m_vertexInputAttributeDescriptions.resize(vertexInputs.size());
+	std::size_t currentAttributeDescriptionIndex = 0;
+
+	for (const auto vertexInput : vertexInputs)
+	{
+		m_vertexInputAttributeDescriptions[currentAttributeDescriptionIndex] = VkVertexInputAttributeDescription{ };
+		m_vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].binding = 0;
+		m_vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].location = vertexInput.location;
+		m_vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].format = vertexInput.format;
+		m_vertexInputAttributeDescriptions[currentAttributeDescriptionIndex].offset = m_vertexInputBindingDescription.stride;
+
+		m_vertexInputBindingDescription.stride += vertexInput.size;
+
+		++currentAttributeDescriptionIndex;
+	}
+}
+
+void ShaderProgram::InitialiseDescriptorSetLayouts()
+{
+	for (const auto& shaderModule : m_shaderModules)
+	{
+		const ShaderReflectionData& reflectionData = shaderModule->GetReflectionData();
+
+		for (const auto& descriptorBinding : reflectionData.descriptorBindings)
+		{
+			if (descriptorBinding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER && (descriptorBinding.set != s_UniformDescriptorSet || descriptorBinding.count != 1))
+			{
+				throw std::runtime_error("Vulkan uniform buffers must be single bindings in descriptor set zero in this renderer.");
+			}
+
+			auto& setBindingsData = m_bindingsData[descriptorBinding.set];
+
+			if (setBindingsData.find(descriptorBinding.binding) == std::cend(setBindingsData))
+			{
+				DescriptorSetBindingData currentBindingData{
+					.size = std::nullopt,
+					.type = descriptorBinding.type,
+					.shaderStages = static_cast<VkShaderStageFlags>(shaderModule->GetStage()),
+					.count = descriptorBinding.count,
+					.isBindless = descriptorBinding.count == 0
+				};
+
+				if (descriptorBinding.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER)
+				{
+					VkDeviceSize size = descriptorBinding.size;
+					size += s_minOffsetAlignment - (size % s_minOffsetAlignment);
+
+					currentBindingData.size = static_cast<std::uint32_t>(size);
+					currentBindingData.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+				}
+				else if (currentBindingData.isBindless)
+				{
+					currentBindingData.count = GetBindlessDescriptorCount(descriptorBinding.type);
+				}
+
+				setBindingsData[descriptorBinding.binding] = currentBindingData;
+			}
+			else
+			{
+				setBindingsData[descriptorBinding.binding].shaderStages |= static_cast<VkShaderStageFlags>(shaderModule->GetStage());
+			}
+		}
+
+		if (reflectionData.pushConstantSize != 0)
+		{
+			if (m_pushConstantRange.stageFlags == 0)
+			{
+				m_pushConstantRange.stageFlags = static_cast<VkShaderStageFlags>(shaderModule->GetStage());
+				m_pushConstantRange.size = reflectionData.pushConstantSize;
+				m_pushConstantRange.offset = 0;
+
+				if (m_pushConstantRange.size > s_maxPushConstantBufferSize)
+				{
+					throw std::runtime_error("Push constant buffer is too large in Vulkan shader.");
+				}
+			}
+			else
+			{
+				m_pushConstantRange.stageFlags |= static_cast<VkShaderStageFlags>(shaderModule->GetStage());
+			}
+		}
+	}
+
+	m_bindingsData.try_emplace(s_UniformDescriptorSet);
+	m_descriptorSetLayouts.resize(std::crbegin(m_bindingsData)->first + 1u, VK_NULL_HANDLE);
+
+	for (std::uint32_t set = 0; set < m_descriptorSetLayouts.size(); ++set)
+	{
+		InitialiseDescriptorSetLayout(set);
+	}
+}
+
+void ShaderProgram::InitialiseDescriptorSetLayout(const std::uint32_t set)
+{
+	std::vector<VkDescriptorSetLayoutBinding> descriptorSetLayoutBindings;
+	std::vector<VkDescriptorBindingFlagsEXT> descriptorBindingFlags;
+	bool isUpdateAfterBind = false;
+	bool hasDynamicUniformBuffers = false;
+
+	if (const auto setBindingsDataLocation = m_bindingsData.find(set);
+		setBindingsDataLocation != std::cend(m_bindingsData))
+	{
+		for (const auto& [binding, bindingData] : setBindingsDataLocation->second)
+		{
+			VkDescriptorSetLayoutBinding descriptorSetLayoutBinding{ };
+			descriptorSetLayoutBinding.binding = binding;
+			descriptorSetLayoutBinding.descriptorType = bindingData.type;
+			descriptorSetLayoutBinding.descriptorCount = bindingData.count;
+			descriptorSetLayoutBinding.stageFlags = bindingData.shaderStages;
+			descriptorSetLayoutBinding.pImmutableSamplers = nullptr;
+
+			descriptorSetLayoutBindings.push_back(descriptorSetLayoutBinding);
+			descriptorBindingFlags.push_back(bindingData.isBindless
+				? VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT_EXT | VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT_EXT | VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT_EXT
+				: 0
+			);
+
+			isUpdateAfterBind = isUpdateAfterBind || bindingData.isBindless;
+			hasDynamicUniformBuffers = hasDynamicUniformBuffers || bindingData.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+
+			m_descriptorTypeCounts[bindingData.type] += bindingData.count;
+		}
+	}
+
+	if (isUpdateAfterBind && hasDynamicUniformBuffers)
+	{
+		throw std::runtime_error("Bindless descriptor arrays cannot share a Vulkan descriptor set with uniform buffers.");
+	}
+
+	VkDescriptorSetLayoutBindingFlagsCreateInfoEXT descriptorSetLayoutBindingFlagsCreateInfo{ };
+	descriptorSetLayoutBindingFlagsCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO_EXT;
+	descriptorSetLayoutBindingFlagsCreateInfo.bindingCount = static_cast<std::uint32_t>(descriptorBindingFlags.size());
+	descriptorSetLayoutBindingFlagsCreateInfo.pBindingFlags = descriptorBindingFlags.data();
+
+	VkDescriptorSetLayoutCreateInfo descriptorSetLayoutCreateInfo{ };
+	descriptorSetLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+	descriptorSetLayoutCreateInfo.pNext = isUpdateAfterBind ? &descriptorSetLayoutBindingFlagsCreateInfo : nullptr;
+	descriptorSetLayoutCreateInfo.flags = isUpdateAfterBind ? VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT_EXT : 0;
+	descriptorSetLayoutCreateInfo.bindingCount = static_cast<std::uint32_t>(descriptorSetLayoutBindings.size());
+	descriptorSetLayoutCreateInfo.pBindings = descriptorSetLayoutBindings.data();
+
+	if (vkCreateDescriptorSetLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorSetLayoutCreateInfo, nullptr, &m_descriptorSetLayouts[set]) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create Vulkan descriptor set layout.");
+	}
+
+	m_hasBindlessBindings = m_hasBindlessBindings || isUpdateAfterBind;
+}
+
+void ShaderProgram::DestroyDescriptorSetLayouts() noexcept
+{
+	for (const auto descriptorSetLayout : m_descriptorSetLayouts)
+	{
+		if (descriptorSetLayout != VK_NULL_HANDLE)
+		{
+			vkDestroyDescriptorSetLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), descriptorSetLayout, nullptr);
+		}
+	}
+
+	m_descriptorSetLayouts.clear();
+}
+
+[[nodiscard]] std::uint32_t ShaderProgram::GetBindlessDescriptorCount(const VkDescriptorType descriptorType) const
+{
+	const VulkanContext& vulkanContext = m_renderer.GetVulkanContext();
+
+	if (!vulkanContext.SupportsDescriptorIndexing())
+	{
+		throw std::runtime_error("Bindless descriptor arrays require Vulkan descriptor indexing support.");
+	}
+
+	switch (descriptorType)
+	{
+	case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+		return std::min(s_MaxBindlessDescriptorCount, vulkanContext.GetDescriptorIndexingLimits().maxStorageBuffers);
+
+	case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+	case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+		return std::min(s_MaxBindlessDescriptorCount, vulkanContext.GetDescriptorIndexingLimits().maxSampledImages);
+
+	default:
+		throw std::runtime_error("Unsupported bindless descriptor type in Vulkan shader.");
+	}
+}
+
+void ShaderProgram::InitialisePipelineLayout()
+{
+	InitialiseDescriptorSetLayouts();
+
+	VkPipelineLayoutCreateInfo pipelineLayoutCreateInfo{ };
+	pipelineLayoutCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+	pipelineLayoutCreateInfo.setLayoutCount = static_cast<std::uint32_t>(m_descriptorSetLayouts.size());
+	pipelineLayoutCreateInfo.pSetLayouts = m_descriptorSetLayouts.data();
+	pipelineLayoutCreateInfo.pushConstantRangeCount = 1;
+	pipelineLayoutCreateInfo.pPushConstantRanges = &m_pushConstantRange;
+
+	if (vkCreatePipelineLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), &pipelineLayoutCreateInfo, nullptr, &m_pipelineLayout) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create Vulkan pipeline layout.");
+	}
+}
+
+void ShaderProgram::DestroyPipelineLayout() noexcept
+{
+	if (m_pipelineLayout != VK_NULL_HANDLE)
+	{
+		vkDestroyPipelineLayout(m_renderer.GetVulkanContext().GetLogicalDevice(), m_pipelineLayout, nullptr);
+		m_pipelineLayout = VK_NULL_HANDLE;
+	}
+
+	DestroyDescriptorSetLayouts();
+}
+
+void ShaderProgram::InitialiseDescriptorPool()
+{
+	std::vector<VkDescriptorPoolSize> poolSizes(m_descriptorTypeCounts.size());
+	std::size_t poolSizeIndex = 0;
+
+	for (const auto [type, count] : m_descriptorTypeCounts)
+	{
+		poolSizes[poolSizeIndex].type = type;
+		poolSizes[poolSizeIndex].descriptorCount = count;
+
+		++poolSizeIndex;
+	}
+
+	VkDescriptorPoolCreateInfo descriptorPoolCreateInfo{ };
+	descriptorPoolCreateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+	descriptorPoolCreateInfo.poolSizeCount = static_cast<std::uint32_t>(poolSizes.size());
+	descriptorPoolCreateInfo.pPoolSizes = poolSizes.data();
+	descriptorPoolCreateInfo.flags = m_hasBindlessBindings ? VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT_EXT : 0;
+	descriptorPoolCreateInfo.maxSets = static_cast<std::uint32_t>(m_descriptorSetLayouts.size());
+
+	if (vkCreateDescriptorPool(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorPoolCreateInfo, nullptr, &m_descriptorPool) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to create Vulkan descriptor pool.");
+	}
+}
+
+void ShaderProgram::DestroyDescriptorPool() noexcept
+{
+	if (m_descriptorPool != VK_NULL_HANDLE)
+	{
+		vkDestroyDescriptorPool(m_renderer.GetVulkanContext().GetLogicalDevice(), m_descriptorPool, nullptr);
+		m_descriptorPool = VK_NULL_HANDLE;
+
+		m_descriptorSets.clear();
+	}
+}
+
+void ShaderProgram::InitialiseUniformBuffers()
+{
+	DestroyUniformBuffers();
+
+	m_uniformBlockSize = 0;
+	m_dynamicOffsetCount = 0;
+
+	for (const auto& [binding, bindingData] : m_bindingsData.at(s_UniformDescriptorSet))
+	{
+		if (bindingData.type == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+		{
+			m_uniformBlockSize += bindingData.size.value();
+			++m_dynamicOffsetCount;
+		}
+	}
+
+	if (m_dynamicOffsetCount > s_MaxDynamicOffsetCount)
+	{
+		throw std::runtime_error("Shader program uses too many dynamic uniform buffers.");
+	}
+
+	if (m_uniformBlockSize > 0)
+	{
+		m_uniformBuffer = std::make_unique<UniformBuffer>(m_renderer);
+		m_uniformBuffer->Initialise(m_uniformBlockSize * s_UniformBlocksPerFrame * Renderer::GetMaxFramesInFlight());
+	}
+
+	InitialiseDescriptorSets();
+}
+
+void ShaderProgram::DestroyUniformBuffers() noexcept
+{
+	m_uniformBuffer = nullptr;
+}
+
+void ShaderProgram::InitialiseDescriptorSets()
+{
+	m_descriptorSets.resize(m_descriptorSetLayouts.size(), VK_NULL_HANDLE);
+
+	VkDescriptorSetAllocateInfo descriptorSetAllocateInfo = { };
+	descriptorSetAllocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+	descriptorSetAllocateInfo.descriptorPool = m_descriptorPool;
+	descriptorSetAllocateInfo.descriptorSetCount = static_cast<std::uint32_t>(m_descriptorSetLayouts.size());
+	descriptorSetAllocateInfo.pSetLayouts = m_descriptorSetLayouts.data();
+
+	if (vkAllocateDescriptorSets(m_renderer.GetVulkanContext().GetLogicalDevice(), &descriptorSetAllocateInfo, m_descriptorSets.data()) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to allocate Vulkan descriptor sets.");
+	}
+
+	VkDeviceSize currentOffset = 0;
+
+	for (const auto& [binding, bindingData] : m_bindingsData.at(s_UniformDescriptorSet))
+	{
+		if (bindingData.type != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+		{
+			continue;
+		}
+
+		VkDescriptorBufferInfo descriptorBufferInfo{ };
+		descriptorBufferInfo.buffer = m_uniformBuffer->GetHandle();
+		descriptorBufferInfo.offset = currentOffset;
+		descriptorBufferInfo.range = bindingData.size.value();
+
+		WriteDescriptor(DescriptorLocation{ s_UniformDescriptorSet, binding, 0 }, bindingData.type, &descriptorBufferInfo, nullptr);
+
+		currentOffset += bindingData.size.value();
+	}
+
+	for (const auto& [location, descriptorBufferInfo] : m_boundStorageBuffers)
+	{
+		WriteDescriptor(location, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &descriptorBufferInfo, nullptr);
+	}
+
+	for (const auto& [location, descriptorImageInfo] : m_boundImages)
+	{
+		const auto& [set, binding, arrayElement] = location;
+
+		WriteDescriptor(location, m_bindingsData.at(set).at(binding).type, nullptr, &descriptorImageInfo);
+	}
+}
+
+[[nodiscard]] const ShaderProgram::DescriptorSetBindingData& ShaderProgram::GetBindingData(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement) const
+{
+	const auto setBindingsDataLocation = m_bindingsData.find(set);
+
+	if (setBindingsDataLocation == std::cend(m_bindingsData))
+	{
+		throw std::out_of_range("Vulkan descriptor set is not used by this shader program.");
+	}
+
+	const auto bindingDataLocation = setBindingsDataLocation->second.find(binding);
+
+	if (bindingDataLocation == std::cend(setBindingsDataLocation->second))
+	{
+		throw std::out_of_range("Vulkan descriptor binding is not used by this shader program.");
+	}
+
+	if (arrayElement >= bindingDataLocation->second.count)
+	{
+		throw std::out_of_range("Vulkan descriptor array element exceeds the binding's descriptor count.");
+	}
+
+	return bindingDataLocation->second;
+}
+
+void ShaderProgram::ValidateDescriptorWrite(const DescriptorSetBindingData& bindingData) const
+{
+	if (!bindingData.isBindless && m_areDescriptorSetsBound)
+	{
+		throw std::logic_error("Vulkan descriptor bindings without update-after-bind cannot be written once their descriptor set has been bound.");
+	}
+}
+
+void ShaderProgram::WriteDescriptor(const DescriptorLocation& location, const VkDescriptorType descriptorType, const VkDescriptorBufferInfo* const bufferInfo, const VkDescriptorImageInfo* const imageInfo)
+{
+	const auto& [set, binding, arrayElement] = location;
+
+	VkWriteDescriptorSet writeDescriptorSet{ };
+	writeDescriptorSet.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+	writeDescriptorSet.dstSet = m_descriptorSets[set];
+	writeDescriptorSet.dstBinding = binding;
+	writeDescriptorSet.dstArrayElement = arrayElement;
+	writeDescriptorSet.descriptorType = descriptorType;
+	writeDescriptorSet.descriptorCount = 1;
+	writeDescriptorSet.pBufferInfo = bufferInfo;
+	writeDescriptorSet.pImageInfo = imageInfo;
+	writeDescriptorSet.pTexelBufferView = nullptr;
+
+	vkUpdateDescriptorSets(m_renderer.GetVulkanContext().GetLogicalDevice(), 1, &writeDescriptorSet, 0, nullptr);
+}
+
+void ShaderProgram::SetStorageBuffer(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkBuffer buffer, const VkDeviceSize offset, const VkDeviceSize range)
+{
+	const DescriptorSetBindingData& bindingData = GetBindingData(set, binding, arrayElement);
+
+	if (bindingData.type != VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+	{
+		throw std::runtime_error("Vulkan descriptor binding is not a storage buffer.");
+	}
+
+	const DescriptorLocation location{ set, binding, arrayElement };
+
+	if (const auto boundStorageBufferLocation = m_boundStorageBuffers.find(location);
+		boundStorageBufferLocation != std::cend(m_boundStorageBuffers))
+	{
+		const VkDescriptorBufferInfo& boundStorageBuffer = boundStorageBufferLocation->second;
+
+		if (boundStorageBuffer.buffer == buffer && boundStorageBuffer.offset == offset && boundStorageBuffer.range == range)
+		{
+			return;
+		}
+	}
+
+	ValidateDescriptorWrite(bindingData);
+
+	VkDescriptorBufferInfo descriptorBufferInfo{ };
+	descriptorBufferInfo.buffer = buffer;
+	descriptorBufferInfo.offset = offset;
+	descriptorBufferInfo.range = range;
+
+	m_boundStorageBuffers[location] = descriptorBufferInfo;
+
+	WriteDescriptor(location, bindingData.type, &descriptorBufferInfo, nullptr);
+}
+
+void ShaderProgram::SetImage(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkImageView imageView, const VkSampler sampler)
+{
+	const DescriptorSetBindingData& bindingData = GetBindingData(set, binding, arrayElement);
+
+	if (bindingData.type != VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE && bindingData.type != VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER)
+	{
+		throw std::runtime_error("Vulkan descriptor binding is not a sampled image.");
+	}
+
+	const DescriptorLocation location{ set, binding, arrayElement };
+
+	if (const auto boundImageLocation = m_boundImages.find(location);
+		boundImageLocation != std::cend(m_boundImages))
+	{
+		const VkDescriptorImageInfo& boundImage = boundImageLocation->second;
+
+		if (boundImage.imageView == imageView && boundImage.sampler == sampler)
+		{
+			return;
+		}
+	}
+
+	ValidateDescriptorWrite(bindingData);
+
+	VkDescriptorImageInfo descriptorImageInfo{ };
+	descriptorImageInfo.imageLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+	descriptorImageInfo.imageView = imageView;
+	descriptorImageInfo.sampler = sampler;
+
+	m_boundImages[location] = descriptorImageInfo;
+
+	WriteDescriptor(location, bindingData.type, nullptr, &descriptorImageInfo);
+}
+
+[[nodiscard]] std::uint32_t ShaderProgram::GetUniformBlockOffset(const std::uint32_t frameIndex, const std::uint32_t blockIndex) const
+{
+	if (blockIndex >= s_UniformBlocksPerFrame)
+	{
+		throw std::out_of_range("Uniform block index exceeds the per-frame uniform ring.");
+	}
+
+	return static_cast<std::uint32_t>((static_cast<VkDeviceSize>(frameIndex) * s_UniformBlocksPerFrame + blockIndex) * m_uniformBlockSize);
+}
+
+[[nodiscard]] std::uint32_t ShaderProgram::GetDescriptorCount(const std::uint32_t set, const std::uint32_t binding) const
+{
+	return GetBindingData(set, binding, 0).count;
+}
+
+void ShaderProgram::SetUniformBufferData(const std::uint32_t updatedBinding, const void* data, const std::uint32_t blockIndex)
+{
+	VkDeviceSize offset = GetUniformBlockOffset(m_renderer.GetCurrentFrameIndex(), blockIndex);
+	std::size_t size = 0;
+
+	for (const auto& [binding, bindingData] : m_bindingsData.at(s_UniformDescriptorSet))
+	{
+		if (bindingData.type != VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC)
+		{
+			continue;
+		}
+
+		if (binding == updatedBinding)
+		{
+			size = bindingData.size.value();
+
+			break;
+		}
+
+		offset += bindingData.size.value();
+	}
+
+	m_uniformBuffer->SetBufferData(data, size, offset);
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "../buffers/UniformBuffer.h"
+#include "ShaderArchive.h"
+#include "ShaderModule.h"
+
+class ShaderProgram
+	: private INoncopyable, private INonmovable
+{
+private:
+	struct VertexInputData
+	{
+		std::uint32_t location;
+
+		std::uint32_t size;
+		VkFormat format;
+
+		inline bool operator <(const VertexInputData& other) const noexcept { return this->location < other.location; }
+	};
+
+	struct DescriptorSetBindingData
+	{
+		std::optional<std::uint32_t> size;
+		VkDescriptorType type;
+		VkShaderStageFlags shaderStages;
+
+		std::uint32_t count;
+		bool isBindless;
+	};
+
+	using DescriptorLocation = std::tuple<std::uint32_t, std::uint32_t, std::uint32_t>;
+
+	static constexpr std::uint32_t s_UniformBlocksPerFrame = 64u;
+	static constexpr std::uint32_t s_MaxDynamicOffsetCount = 8u;
+	static constexpr std::uint32_t s_UniformDescriptorSet = 0u;
+	static constexpr std::uint32_t s_MaxBindlessDescriptorCount = 4'096u;
+
+	inline static VkDeviceSize s_minOffsetAlignment = std::numeric_limits<VkDeviceSize>::max();
+	inline static std::uint32_t s_maxPushConstantBufferSize = 0;
+
+	const class Renderer& m_renderer;
+
+	std::vector<std::unique_ptr<ShaderModule>> m_shaderModules;
+	std::vector<VkPipelineShaderStageCreateInfo> m_shaderStageCreateInfos;
+
+	VkVertexInputBindingDescription m_vertexInputBindingDescription{ };
+	std::vector<VkVertexInputAttributeDescription> m_vertexInputAttributeDescriptions;
+
+	std::vector<VkDescriptorSetLayout> m_descriptorSetLayouts;
+	VkPushConstantRange m_pushConstantRange{ };
+	VkPipelineLayout m_pipelineLayout = VK_NULL_HANDLE;
+
+	VkDescriptorPool m_descriptorPool = VK_NULL_HANDLE;
+
+	std::unique_ptr<UniformBuffer> m_uniformBuffer = nullptr;
+	VkDeviceSize m_uniformBlockSize = 0;
+	std::uint32_t m_dynamicOffsetCount = 0;
+
+	std::vector<VkDescriptorSet> m_descriptorSets;
+	mutable std::atomic<bool> m_areDescriptorSetsBound = false;
+
+	std::map<std::uint32_t, std::map<std::uint32_t, DescriptorSetBindingData>> m_bindingsData;
+	std::unordered_map<VkDescriptorType, std::uint32_t> m_descriptorTypeCounts;
+	bool m_hasBindlessBindings = false;
+
+	std::map<DescriptorLocation, VkDescriptorBufferInfo> m_boundStorageBuffers;
+	std::map<DescriptorLocation, VkDescriptorImageInfo> m_boundImages;
+
+public:
+	ShaderProgram(const class Renderer& renderer, const std::vector<std::pair<std::string, ShaderModule::Stage>>& shaderInfo, const ShaderArchive* const shaderArchive = nullptr);
+	~ShaderProgram() noexcept;
+
+	void Destroy() noexcept;
+
+	void RefreshUniformBuffers();
+
+	template <typename T>
+	inline void SetUniform(const std::uint32_t binding, const T& data, const std::uint32_t blockIndex = 0)
+	{
+		SetUniformBufferData(binding, &data, blockIndex);
+	}
+
+	void SetStorageBuffer(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkBuffer buffer, const VkDeviceSize offset = 0, const VkDeviceSize range = VK_WHOLE_SIZE);
+	void SetImage(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement, const VkImageView imageView, const VkSampler sampler = VK_NULL_HANDLE);
+
+	[[nodiscard]] std::uint32_t GetUniformBlockOffset(const std::uint32_t frameIndex, const std::uint32_t blockIndex) const;
+	[[nodiscard]] std::uint32_t GetDescriptorCount(const std::uint32_t set, const std::uint32_t binding) const;
+
+	static constexpr std::uint32_t GetUniformBlocksPerFrame() noexcept { return s_UniformBlocksPerFrame; }
+	static constexpr std::uint32_t GetMaxDynamicOffsetCount() noexcept { return s_MaxDynamicOffsetCount; }
+
+	inline const std::vector<std::unique_ptr<ShaderModule>>& GetShaderModules() const noexcept { return m_shaderModules; }
+	inline const std::vector<VkPipelineShaderStageCreateInfo>& GetShaderStageCreateInfos() const noexcept { return m_shaderStageCreateInfos; }
+	inline const VkVertexInputBindingDescription& GetVertexInputBindingDescription() const noexcept { return m_vertexInputBindingDescription; }
+	inline const std::vector<VkVertexInputAttributeDescription>& GetVertexInputAttributeDescriptions() const noexcept { return m_vertexInputAttributeDescriptions; }
+
+	inline VkPipelineLayout GetLayout() const noexcept { return m_pipelineLayout; }
+	inline const std::vector<VkDescriptorSet>& GetDescriptorSets() const noexcept { return m_descriptorSets; }
+	inline void MarkDescriptorSetsBound() const noexcept { m_areDescriptorSetsBound = true; }
+	inline std::uint32_t GetDynamicOffsetCount() const noexcept { return m_dynamicOffsetCount; }
+
+	inline VkShaderStageFlags GetPushConstantStageFlags() const noexcept { return m_pushConstantRange.stageFlags; }
+
+private:
+	void InitialiseShaderModules(const std::vector<std::pair<std::string, ShaderModule::Stage>>& shaderInfo, const ShaderArchive* const shaderArchive);
+	void DestroyShaderModules() noexcept;
+
+	void InitialiseVertexInputData();
+
+	void InitialiseDescriptorSetLayouts();
+	void InitialiseDescriptorSetLayout(const std::uint32_t set);
+	void DestroyDescriptorSetLayouts() noexcept;
+	[[nodiscard]] std::uint32_t GetBindlessDescriptorCount(const VkDescriptorType descriptorType) const;
+
+	void InitialisePipelineLayout();
+	void DestroyPipelineLayout() noexcept;
+
+	void InitialiseDescriptorPool();
+	void DestroyDescriptorPool() noexcept;
+
+	void InitialiseUniformBuffers();
+	void DestroyUniformBuffers() noexcept;
+
+	void InitialiseDescriptorSets();
+	[[nodiscard]] const DescriptorSetBindingData& GetBindingData(const std::uint32_t set, const std::uint32_t binding, const std::uint32_t arrayElement) const;
+	void ValidateDescriptorWrite(const DescriptorSetBindingData& bindingData) const;
+	void WriteDescriptor(const DescriptorLocation& location, const VkDescriptorType descriptorType, const VkDescriptorBufferInfo* const bufferInfo, const VkDescriptorImageInfo* const imageInfo);
+
+	void SetUniformBufferData(const std::uint32_t updatedBinding, const void* data, const std::uint32_t blockIndex);
+};
\ No newline at end of file
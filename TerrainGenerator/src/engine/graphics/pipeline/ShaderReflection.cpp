@@ -0,0 +1,407 @@
+#include "ShaderReflection.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace
+{
+	std::uint32_t GetVertexInputSize(const spirv_cross::SPIRType& vertexInputType)
+	{
+		std::uint32_t size = vertexInputType.vecsize;
+
+		switch (vertexInputType.basetype)
+		{
+		case spirv_cross::SPIRType::BaseType::Boolean:
+			break;
+
+		case spirv_cross::SPIRType::BaseType::Half:
+			size *= 2;
+
+			break;
+
+		case spirv_cross::SPIRType::BaseType::Int:
+		case spirv_cross::SPIRType::BaseType::UInt:
+		case spirv_cross::SPIRType::BaseType::Float:
+			size *= 4;
+
+			break;
+
+		case spirv_cross::SPIRType::BaseType::Double:
+			size *= 8;
+
+			break;
+
+		default:
+			return 0;
+		}
+
+		return size;
+	}
+
+	VkFormat GetVertexInputFormat(const spirv_cross::SPIRType& vertexInputType)
+	{
+		switch (vertexInputType.vecsize)
+		{
+		case 1:
+			switch (vertexInputType.basetype)
+			{
+			case spirv_cross::SPIRType::BaseType::Boolean:
+				return VK_FORMAT_R8_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Half:
+				return VK_FORMAT_R16_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Int:
+				return VK_FORMAT_R32_SINT;
+
+			case spirv_cross::SPIRType::BaseType::UInt:
+				return VK_FORMAT_R32_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Float:
+				return VK_FORMAT_R32_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Double:
+				return VK_FORMAT_R64_SFLOAT;
+
+			default:
+				break;
+			}
+
+			break;
+
+		case 2:
+			switch (vertexInputType.basetype)
+			{
+			case spirv_cross::SPIRType::BaseType::Boolean:
+				return VK_FORMAT_R8G8_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Half:
+				return VK_FORMAT_R16G16_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Int:
+				return VK_FORMAT_R32G32_SINT;
+
+			case spirv_cross::SPIRType::BaseType::UInt:
+				return VK_FORMAT_R32G32_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Float:
+				return VK_FORMAT_R32G32_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Double:
+				return VK_FORMAT_R64G64_SFLOAT;
+
+			default:
+				break;
+			}
+
+			break;
+
+		case 3:
+			switch (vertexInputType.basetype)
+			{
+			case spirv_cross::SPIRType::BaseType::Boolean:
+				return VK_FORMAT_R8G8B8_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Half:
+				return VK_FORMAT_R16G16B16_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Int:
+				return VK_FORMAT_R32G32B32_SINT;
+
+			case spirv_cross::SPIRType::BaseType::UInt:
+				return VK_FORMAT_R32G32B32_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Float:
+				return VK_FORMAT_R32G32B32_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Double:
+				return VK_FORMAT_R64G64B64_SFLOAT;
+
+			default:
+				break;
+			}
+
+			break;
+
+		case 4:
+			switch (vertexInputType.basetype)
+			{
+			case spirv_cross::SPIRType::BaseType::Boolean:
+				return VK_FORMAT_R8G8B8A8_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Half:
+				return VK_FORMAT_R16G16B16A16_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Int:
+				return VK_FORMAT_R32G32B32A32_SINT;
+
+			case spirv_cross::SPIRType::BaseType::UInt:
+				return VK_FORMAT_R32G32B32A32_UINT;
+
+			case spirv_cross::SPIRType::BaseType::Float:
+				return VK_FORMAT_R32G32B32A32_SFLOAT;
+
+			case spirv_cross::SPIRType::BaseType::Double:
+				return VK_FORMAT_R64G64B64A64_SFLOAT;
+
+			default:
+				break;
+			}
+
+			break;
+
+		default:
+			break;
+		}
+
+		return VK_FORMAT_UNDEFINED;
+	}
+
+	std::uint32_t GetDescriptorCount(const spirv_cross::SPIRType& descriptorType)
+	{
+		std::uint32_t count = 1;
+
+		for (std::size_t i = 0; i < descriptorType.array.size(); ++i)
+		{
+			if (!descriptorType.array_size_literal[i])
+			{
+				throw std::runtime_error("Descriptor arrays sized by specialisation constants are not supported.");
+			}
+
+			count *= descriptorType.array[i];
+		}
+
+		return count;
+	}
+
+	void WriteUInt32(std::vector<std::byte>& data, const std::uint32_t value)
+	{
+		const std::size_t currentSize = data.size();
+
+		data.resize(currentSize + sizeof(std::uint32_t));
+		std::memcpy(data.data() + currentSize, &value, sizeof(std::uint32_t));
+	}
+
+	void WriteString(std::vector<std::byte>& data, const std::string& value)
+	{
+		WriteUInt32(data, static_cast<std::uint32_t>(value.size()));
+
+		const std::size_t currentSize = data.size();
+		const std::size_t paddedSize = (value.size() + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t) * sizeof(std::uint32_t);
+
+		data.resize(currentSize + paddedSize, std::byte{ 0 });
+		std::memcpy(data.data() + currentSize, value.data(), value.size());
+	}
+
+	[[nodiscard]] std::uint32_t ReadUInt32(const std::byte* data, const std::size_t size, std::size_t& offset)
+	{
+		if (offset + sizeof(std::uint32_t) > size)
+		{
+			throw std::runtime_error("Shader reflection data is truncated.");
+		}
+
+		std::uint32_t value = 0;
+		std::memcpy(&value, data + offset, sizeof(std::uint32_t));
+		offset += sizeof(std::uint32_t);
+
+		return value;
+	}
+
+	[[nodiscard]] std::size_t ReadRecordCount(const std::byte* data, const std::size_t size, std::size_t& offset, const std::size_t minRecordSize)
+	{
+		const std::size_t count = ReadUInt32(data, size, offset);
+
+		if (count * minRecordSize > size - offset)
+		{
+			throw std::runtime_error("Shader reflection data is truncated.");
+		}
+
+		return count;
+	}
+
+	[[nodiscard]] std::string ReadString(const std::byte* data, const std::size_t size, std::size_t& offset)
+	{
+		const std::size_t length = ReadUInt32(data, size, offset);
+		const std::size_t paddedLength = (length + sizeof(std::uint32_t) - 1) / sizeof(std::uint32_t) * sizeof(std::uint32_t);
+
+		if (offset + paddedLength > size)
+		{
+			throw std::runtime_error("Shader reflection data is truncated.");
+		}
+
+		std::string value(reinterpret_cast<const char*>(data + offset), length);
+		offset += paddedLength;
+
+		return value;
+	}
+}
+
+namespace shader_reflection
+{
+	[[nodiscard]] ShaderReflectionData Reflect(const spirv_cross::Compiler& compiler)
+	{
+		ShaderReflectionData reflectionData{ };
+		const spirv_cross::ShaderResources shaderResources = compiler.get_shader_resources();
+
+		for (const auto& shaderInput : shaderResources.stage_inputs)
+		{
+			const spirv_cross::SPIRType& type = compiler.get_type(shaderInput.base_type_id);
+
+			reflectionData.vertexInputs.push_back(ShaderReflectionData::VertexInput{
+				.location = compiler.get_decoration(shaderInput.id, spv::Decoration::DecorationLocation),
+				.size = GetVertexInputSize(type),
+				.format = GetVertexInputFormat(type)
+			});
+		}
+
+		for (const auto& uniform : shaderResources.uniform_buffers)
+		{
+			reflectionData.descriptorBindings.push_back(ShaderReflectionData::DescriptorBinding{
+				.set = compiler.get_decoration(uniform.id, spv::Decoration::DecorationDescriptorSet),
+				.binding = compiler.get_decoration(uniform.id, spv::Decoration::DecorationBinding),
+				.type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+				.size = static_cast<std::uint32_t>(compiler.get_declared_struct_size(compiler.get_type(uniform.base_type_id))),
+				.count = GetDescriptorCount(compiler.get_type(uniform.type_id))
+			});
+		}
+
+		for (const auto& storageBuffer : shaderResources.storage_buffers)
+		{
+			reflectionData.descriptorBindings.push_back(ShaderReflectionData::DescriptorBinding{
+				.set = compiler.get_decoration(storageBuffer.id, spv::Decoration::DecorationDescriptorSet),
+				.binding = compiler.get_decoration(storageBuffer.id, spv::Decoration::DecorationBinding),
+				.type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+				.size = 0,
+				.count = GetDescriptorCount(compiler.get_type(storageBuffer.type_id))
+			});
+		}
+
+		for (const auto& sampler : shaderResources.sampled_images)
+		{
+			reflectionData.descriptorBindings.push_back(ShaderReflectionData::DescriptorBinding{
+				.set = compiler.get_decoration(sampler.id, spv::Decoration::DecorationDescriptorSet),
+				.binding = compiler.get_decoration(sampler.id, spv::Decoration::DecorationBinding),
+				.type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+				.size = 0,
+				.count = GetDescriptorCount(compiler.get_type(sampler.type_id))
+			});
+		}
+
+		for (const auto& image : shaderResources.separate_images)
+		{
+			reflectionData.descriptorBindings.push_back(ShaderReflectionData::DescriptorBinding{
+				.set = compiler.get_decoration(image.id, spv::Decoration::DecorationDescriptorSet),
+				.binding = compiler.get_decoration(image.id, spv::Decoration::DecorationBinding),
+				.type = VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+				.size = 0,
+				.count = GetDescriptorCount(compiler.get_type(image.type_id))
+			});
+		}
+
+		for (const auto& sampler : shaderResources.separate_samplers)
+		{
+			reflectionData.descriptorBindings.push_back(ShaderReflectionData::DescriptorBinding{
+				.set = compiler.get_decoration(sampler.id, spv::Decoration::DecorationDescriptorSet),
+				.binding = compiler.get_decoration(sampler.id, spv::Decoration::DecorationBinding),
+				.type = VK_DESCRIPTOR_TYPE_SAMPLER,
+				.size = 0,
+				.count = GetDescriptorCount(compiler.get_type(sampler.type_id))
+			});
+		}
+
+		for (const auto& pushConstant : shaderResources.push_constant_buffers)
+		{
+			reflectionData.pushConstantSize = static_cast<std::uint32_t>(compiler.get_declared_struct_size(compiler.get_type(pushConstant.base_type_id)));
+		}
+
+		for (const auto& specialisationConstant : compiler.get_specialization_constants())
+		{
+			const spirv_cross::SPIRType& type = compiler.get_type(compiler.get_constant(specialisationConstant.id).constant_type);
+
+			reflectionData.specialisationConstants.push_back(ShaderReflectionData::SpecialisationConstant{
+				.name = compiler.get_name(specialisationConstant.id),
+				.constantID = specialisationConstant.constant_id,
+				.size = type.basetype == spirv_cross::SPIRType::BaseType::Boolean ? static_cast<std::uint32_t>(sizeof(VkBool32)) : type.width / 8u
+			});
+		}
+
+		return reflectionData;
+	}
+
+	[[nodiscard]] std::vector<std::byte> Serialise(const ShaderReflectionData& reflectionData)
+	{
+		std::vector<std::byte> data;
+
+		WriteUInt32(data, static_cast<std::uint32_t>(reflectionData.vertexInputs.size()));
+
+		for (const auto& vertexInput : reflectionData.vertexInputs)
+		{
+			WriteUInt32(data, vertexInput.location);
+			WriteUInt32(data, vertexInput.size);
+			WriteUInt32(data, static_cast<std::uint32_t>(vertexInput.format));
+		}
+
+		WriteUInt32(data, static_cast<std::uint32_t>(reflectionData.descriptorBindings.size()));
+
+		for (const auto& descriptorBinding : reflectionData.descriptorBindings)
+		{
+			WriteUInt32(data, descriptorBinding.set);
+			WriteUInt32(data, descriptorBinding.binding);
+			WriteUInt32(data, static_cast<std::uint32_t>(descriptorBinding.type));
+			WriteUInt32(data, descriptorBinding.size);
+			WriteUInt32(data, descriptorBinding.count);
+		}
+
+		WriteUInt32(data, static_cast<std::uint32_t>(reflectionData.specialisationConstants.size()));
+
+		for (const auto& specialisationConstant : reflectionData.specialisationConstants)
+		{
+			WriteString(data, specialisationConstant.name);
+			WriteUInt32(data, specialisationConstant.constantID);
+			WriteUInt32(data, specialisationConstant.size);
+		}
+
+		WriteUInt32(data, reflectionData.pushConstantSize);
+
+		return data;
+	}
+
+	[[nodiscard]] ShaderReflectionData Deserialise(const std::byte* data, const std::size_t size)
+	{
+		ShaderReflectionData reflectionData{ };
+		std::size_t offset = 0;
+
+		reflectionData.vertexInputs.resize(ReadRecordCount(data, size, offset, sizeof(std::uint32_t) * 3u));
+
+		for (auto& vertexInput : reflectionData.vertexInputs)
+		{
+			vertexInput.location = ReadUInt32(data, size, offset);
+			vertexInput.size = ReadUInt32(data, size, offset);
+			vertexInput.format = static_cast<VkFormat>(ReadUInt32(data, size, offset));
+		}
+
+		reflectionData.descriptorBindings.resize(ReadRecordCount(data, size, offset, sizeof(std::uint32_t) * 5u));
+
+		for (auto& descriptorBinding : reflectionData.descriptorBindings)
+		{
+			descriptorBinding.set = ReadUInt32(data, size, offset);
+			descriptorBinding.binding = ReadUInt32(data, size, offset);
+			descriptorBinding.type = static_cast<VkDescriptorType>(ReadUInt32(data, size, offset));
+			descriptorBinding.size = ReadUInt32(data, size, offset);
+			descriptorBinding.count = ReadUInt32(data, size, offset);
+		}
+
+		reflectionData.specialisationConstants.resize(ReadRecordCount(data, size, offset, sizeof(std::uint32_t) * 3u));
+
+		for (auto& specialisationConstant : reflectionData.specialisationConstants)
+		{
+			specialisationConstant.name = ReadString(data, size, offset);
+			specialisationConstant.constantID = ReadUInt32(data, size, offset);
+			specialisationConstant.size = ReadUInt32(data, size, offset);
+		}
+
+		reflectionData.pushConstantSize = ReadUInt32(data, size, offset);
+
+		return reflectionData;
+	}
+}
\ No newline at end of file
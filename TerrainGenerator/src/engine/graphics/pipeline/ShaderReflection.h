@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <spirv-cross/spirv_cross.hpp>
+#include <vulkan/vulkan.h>
+
+struct ShaderReflectionData
+{
+	struct VertexInput
+	{
+		std::uint32_t location;
+
+		std::uint32_t size;
+		VkFormat format;
+	};
+
+	struct DescriptorBinding
+	{
+		std::uint32_t set;
+		std::uint32_t binding;
+
+		VkDescriptorType type;
+		std::uint32_t size;
+		std::uint32_t count;
+	};
+
+	struct SpecialisationConstant
+	{
+		std::string name;
+		std::uint32_t constantID;
+		std::uint32_t size;
+	};
+
+	std::vector<VertexInput> vertexInputs;
+	std::vector<DescriptorBinding> descriptorBindings;
+	std::vector<SpecialisationConstant> specialisationConstants;
+	std::uint32_t pushConstantSize = 0;
+};
+
+namespace shader_reflection
+{
+	[[nodiscard]] extern ShaderReflectionData Reflect(const spirv_cross::Compiler& compiler);
+
+	[[nodiscard]] extern std::vector<std::byte> Serialise(const ShaderReflectionData& reflectionData);
+	[[nodiscard]] extern ShaderReflectionData Deserialise(const std::byte* data, const std::size_t size);
+}
\ No newline at end of file
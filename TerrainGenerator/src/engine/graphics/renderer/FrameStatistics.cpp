@@ -0,0 +1,226 @@
+#include "FrameStatistics.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+
+[[nodiscard]] std::uint64_t FrameStatistics::GetTriangleCount(const VkPrimitiveTopology topology, const std::uint64_t indexCount) noexcept
+{
+	switch (topology)
+	{
+	case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST:
+		return indexCount / 3u;
+
+	case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+	case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+		return indexCount > 2u ? indexCount - 2u : 0u;
+
+	default:
+		return 0u;
+	}
+}
+
+[[nodiscard]] std::uint64_t FrameStatistics::GetTriangleCount(const VkPrimitiveTopology topology, const std::span<const std::uint16_t> indices, const std::optional<std::uint16_t> primitiveRestartIndex) noexcept
+{
+	if (!primitiveRestartIndex.has_value())
+	{
+		return GetTriangleCount(topology, indices.size());
+	}
+
+	std::uint64_t triangleCount = 0u;
+	std::uint64_t segmentIndexCount = 0u;
+
+	for (const std::uint16_t index : indices)
+	{
+		if (index == primitiveRestartIndex.value())
+		{
+			triangleCount += GetTriangleCount(topology, segmentIndexCount);
+			segmentIndexCount = 0u;
+		}
+		else
+		{
+			++segmentIndexCount;
+		}
+	}
+
+	return triangleCount + GetTriangleCount(topology, segmentIndexCount);
+}
+
+void FrameStatistics::Add(const Statistic statistic, const std::uint64_t amount) noexcept
+{
+	m_currentValues[static_cast<std::size_t>(statistic)].fetch_add(amount, std::memory_order_relaxed);
+}
+
+void FrameStatistics::Add(const Values& values) noexcept
+{
+	for (std::size_t i = 0; i < s_StatisticCount; ++i)
+	{
+		if (values[i] != 0u)
+		{
+			m_currentValues[i].fetch_add(values[i], std::memory_order_relaxed);
+		}
+	}
+}
+
+void FrameStatistics::Set(const Statistic statistic, const std::uint64_t value) noexcept
+{
+	m_currentValues[static_cast<std::size_t>(statistic)].store(value, std::memory_order_relaxed);
+}
+
+void FrameStatistics::BeginStaging(const std::uint64_t byteCount) noexcept
+{
+	const std::uint64_t stagingBytesInUse = m_stagingBytesInUse.fetch_add(byteCount, std::memory_order_relaxed) + byteCount;
+	std::atomic<std::uint64_t>& peakStagingBytes = m_currentValues[static_cast<std::size_t>(Statistic::PeakStagingBytes)];
+
+	std::uint64_t currentPeakStagingBytes = peakStagingBytes.load(std::memory_order_relaxed);
+
+	while (currentPeakStagingBytes < stagingBytesInUse && !peakStagingBytes.compare_exchange_weak(currentPeakStagingBytes, stagingBytesInUse, std::memory_order_relaxed))
+	{ }
+}
+
+void FrameStatistics::EndStaging(const std::uint64_t byteCount) noexcept
+{
+	m_stagingBytesInUse.fetch_sub(byteCount, std::memory_order_relaxed);
+}
+
+void FrameStatistics::EndFrame()
+{
+	const auto currentTime = std::chrono::steady_clock::now();
+
+	Sample sample{ };
+	sample.frameNumber = m_frameNumber++;
+	sample.timeSeconds = std::chrono::duration<double>(currentTime - m_startTime).count();
+	sample.frameTimeMilliseconds = std::chrono::duration<double, std::milli>(currentTime - m_lastFrameTime).count();
+
+	for (std::size_t i = 0; i < s_StatisticCount; ++i)
+	{
+		if (IsPersistent(static_cast<Statistic>(i)))
+		{
+			sample.values[i] = m_currentValues[i].load(std::memory_order_relaxed);
+		}
+		else
+		{
+			sample.values[i] = m_currentValues[i].exchange(0u, std::memory_order_relaxed);
+		}
+	}
+
+	m_lastFrameTime = currentTime;
+
+	if (m_history.size() == s_HistoryLength)
+	{
+		m_history.pop_front();
+	}
+
+	m_history.push_back(sample);
+}
+
+void FrameStatistics::Export(const std::string& filepath) const
+{
+	constexpr std::string_view JSONExtension = ".json";
+
+	if (filepath.length() >= JSONExtension.length() && filepath.compare(filepath.length() - JSONExtension.length(), JSONExtension.length(), JSONExtension) == 0)
+	{
+		WriteJSON(filepath);
+	}
+	else
+	{
+		WriteCSV(filepath);
+	}
+}
+
+void FrameStatistics::WriteCSV(const std::string& filepath) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open frame statistics file " + filepath + " for writing.");
+	}
+
+	file << "frame,time_s,frame_time_ms";
+
+	for (const auto statisticName : s_StatisticNames)
+	{
+		file << "," << statisticName;
+	}
+
+	file << "\n";
+
+	for (const auto& sample : m_history)
+	{
+		file << sample.frameNumber << "," << sample.timeSeconds << "," << sample.frameTimeMilliseconds;
+
+		for (const auto value : sample.values)
+		{
+			file << "," << value;
+		}
+
+		file << "\n";
+	}
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write frame statistics file " + filepath + ".");
+	}
+}
+
+void FrameStatistics::WriteJSON(const std::string& filepath) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open frame statistics file " + filepath + " for writing.");
+	}
+
+	file << "{\n\t\"samples\": [";
+
+	for (std::size_t i = 0; i < m_history.size(); ++i)
+	{
+		const Sample& sample = m_history[i];
+
+		file << (i == 0 ? "\n" : ",\n") << "\t\t{ \"frame\": " << sample.frameNumber << ", \"time_s\": " << sample.timeSeconds << ", \"frame_time_ms\": " << sample.frameTimeMilliseconds;
+
+		for (std::size_t j = 0; j < s_StatisticCount; ++j)
+		{
+			file << ", \"" << s_StatisticNames[j] << "\": " << sample.values[j];
+		}
+
+		file << " }";
+	}
+
+	file << "\n\t]\n}\n";
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write frame statistics file " + filepath + ".");
+	}
+}
+
+[[nodiscard]] std::string FrameStatistics::GetSummary() const
+{
+	if (m_history.empty())
+	{
+		return std::string{ };
+	}
+
+	const Sample& sample = m_history.back();
+	const auto getValue = [&sample](const Statistic statistic) { return sample.values[static_cast<std::size_t>(statistic)]; };
+
+	constexpr double BytesPerMebibyte = 1'024.0 * 1'024.0;
+
+	std::ostringstream summary;
+	summary.precision(1);
+
+	summary << std::fixed << sample.frameTimeMilliseconds << " ms | "
+		<< getValue(Statistic::DrawCalls) << " draws | "
+		<< getValue(Statistic::TrianglesSubmitted) << " triangles | "
+		<< getValue(Statistic::ChunksGenerated) << " chunks generated | "
+		<< static_cast<double>(getValue(Statistic::BytesUploaded)) / BytesPerMebibyte << " MiB uploaded | "
+		<< static_cast<double>(getValue(Statistic::AllocatedBytes)) / BytesPerMebibyte << " MiB allocated | "
+		<< getValue(Statistic::RenderDistance) << " chunk render distance (" << getValue(Statistic::MemoryPressure) << "% memory pressure)";
+
+	return summary.str();
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <vulkan/vulkan.h>
+
+class FrameStatistics
+	: private INoncopyable, private INonmovable
+{
+public:
+	enum class Statistic
+		: std::size_t
+	{
+		DrawCalls,
+		BufferBinds,
+		PipelineBinds,
+		PushConstantBytes,
+		TrianglesSubmitted,
+		ChunksGenerated,
+		ChunksUploaded,
+		BytesUploaded,
+		PeakStagingBytes,
+		AllocatedBytes,
+		RenderDistance,
+		MemoryPressure,
+		Count
+	};
+
+private:
+	static constexpr std::size_t s_StatisticCount = static_cast<std::underlying_type_t<Statistic>>(Statistic::Count);
+
+public:
+	using Values = std::array<std::uint64_t, s_StatisticCount>;
+
+	struct Sample
+	{
+		std::uint64_t frameNumber = 0u;
+		double timeSeconds = 0.0;
+		double frameTimeMilliseconds = 0.0;
+
+		Values values{ };
+	};
+
+private:
+	static constexpr std::array<const char*, s_StatisticCount> s_StatisticNames{
+		"draw_calls",
+		"buffer_binds",
+		"pipeline_binds",
+		"push_constant_bytes",
+		"triangles_submitted",
+		"chunks_generated",
+		"chunks_uploaded",
+		"bytes_uploaded",
+		"peak_staging_bytes",
+		"allocated_bytes",
+		"render_distance",
+		"memory_pressure_percent"
+	};
+
+	static constexpr std::size_t s_HistoryLength = 600u;
+
+	static constexpr bool IsPersistent(const Statistic statistic) noexcept { return statistic == Statistic::AllocatedBytes || statistic == Statistic::RenderDistance || statistic == Statistic::MemoryPressure; }
+
+	std::array<std::atomic<std::uint64_t>, s_StatisticCount> m_currentValues{ };
+	std::atomic<std::uint64_t> m_stagingBytesInUse = 0u;
+
+	std::deque<Sample> m_history;
+	std::uint64_t m_frameNumber = 0u;
+
+	const std::chrono::steady_clock::time_point m_startTime = std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point m_lastFrameTime = m_startTime;
+
+public:
+	[[nodiscard]] static std::uint64_t GetTriangleCount(const VkPrimitiveTopology topology, const std::uint64_t indexCount) noexcept;
+	[[nodiscard]] static std::uint64_t GetTriangleCount(const VkPrimitiveTopology topology, const std::span<const std::uint16_t> indices, const std::optional<std::uint16_t> primitiveRestartIndex = std::nullopt) noexcept;
+	static constexpr const char* GetStatisticName(const Statistic statistic) noexcept { return s_StatisticNames[static_cast<std::size_t>(statistic)]; }
+
+	FrameStatistics() = default;
+	~FrameStatistics() noexcept = default;
+
+	void Add(const Statistic statistic, const std::uint64_t amount = 1u) noexcept;
+	void Add(const Values& values) noexcept;
+	void Set(const Statistic statistic, const std::uint64_t value) noexcept;
+
+	void BeginStaging(const std::uint64_t byteCount) noexcept;
+	void EndStaging(const std::uint64_t byteCount) noexcept;
+
+	void EndFrame();
+
+	void Export(const std::string& filepath) const;
+	void WriteCSV(const std::string& filepath) const;
+	void WriteJSON(const std::string& filepath) const;
+
+	[[nodiscard]] std::string GetSummary() const;
+	inline const std::deque<Sample>& GetHistory() const noexcept { return m_history; }
+};
\ No newline at end of file
@@ -0,0 +1,290 @@
+#include "GPUProfiler.h"
+
+#include <algorithm>
+#include <exception>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "Renderer.h"
+
+GPUProfiler::Zone::Zone(Renderer& renderer, const char* name)
+	: m_renderer(renderer)
+{
+	m_renderer.BeginGPUZone(name);
+}
+
+GPUProfiler::Zone::~Zone() noexcept
+{
+	try
+	{
+		m_renderer.EndGPUZone();
+	}
+	catch (const std::exception& error)
+	{
+		std::cerr << error.what() << "\n";
+	}
+}
+
+GPUProfiler::GPUProfiler(const VulkanContext& vulkanContext, const std::uint32_t frameCount)
+	: m_vulkanContext(vulkanContext)
+{
+	Initialise(frameCount);
+}
+
+GPUProfiler::~GPUProfiler() noexcept
+{
+	Destroy();
+}
+
+void GPUProfiler::BeginFrame(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex)
+{
+	if (!IsSupported())
+	{
+		return;
+	}
+
+	FrameQueries& frame = m_frameQueries[frameIndex];
+
+	if (frame.isSubmitted)
+	{
+		ResolveFrame(frame);
+	}
+
+	frame.zones.clear();
+	frame.pipelineStatisticsQueryCount = 0u;
+	frame.isSubmitted = false;
+	m_openZoneIndices.clear();
+
+	vkCmdResetQueryPool(commandBuffer, frame.timestampQueryPool, 0, s_MaxZonesPerFrame * 2u);
+
+	if (frame.pipelineStatisticsQueryPool != VK_NULL_HANDLE)
+	{
+		vkCmdResetQueryPool(commandBuffer, frame.pipelineStatisticsQueryPool, 0, s_MaxZonesPerFrame);
+	}
+}
+
+void GPUProfiler::EndFrame(const std::uint32_t frameIndex)
+{
+	if (!IsSupported())
+	{
+		return;
+	}
+
+	if (!m_openZoneIndices.empty())
+	{
+		throw std::logic_error("All GPU profiler zones must be ended before the frame is submitted.");
+	}
+
+	m_frameQueries[frameIndex].submissionTimestamp = Profiler::Get().GetTimestamp();
+	m_frameQueries[frameIndex].isSubmitted = true;
+}
+
+void GPUProfiler::BeginZone(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex, const char* name)
+{
+	if (!IsSupported())
+	{
+		return;
+	}
+
+	FrameQueries& frame = m_frameQueries[frameIndex];
+
+	if (frame.zones.size() == s_MaxZonesPerFrame)
+	{
+		m_openZoneIndices.push_back(std::numeric_limits<std::size_t>::max());
+
+		return;
+	}
+
+	const std::uint32_t zoneIndex = static_cast<std::uint32_t>(frame.zones.size());
+
+	RecordedZone zone{ };
+	zone.name = name;
+	zone.beginTimestampIndex = zoneIndex * 2u;
+	zone.endTimestampIndex = zoneIndex * 2u + 1u;
+
+	vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, frame.timestampQueryPool, zone.beginTimestampIndex);
+
+	if (SupportsPipelineStatistics() && m_openZoneIndices.empty())
+	{
+		zone.pipelineStatisticsIndex = frame.pipelineStatisticsQueryCount++;
+		vkCmdBeginQuery(commandBuffer, frame.pipelineStatisticsQueryPool, zone.pipelineStatisticsIndex.value(), 0);
+	}
+
+	frame.zones.push_back(zone);
+	m_openZoneIndices.push_back(zoneIndex);
+}
+
+void GPUProfiler::EndZone(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex)
+{
+	if (!IsSupported())
+	{
+		return;
+	}
+
+	if (m_openZoneIndices.empty())
+	{
+		throw std::logic_error("GPU profiler zone ended without a matching begin.");
+	}
+
+	const std::size_t zoneIndex = m_openZoneIndices.back();
+	m_openZoneIndices.pop_back();
+
+	if (zoneIndex == std::numeric_limits<std::size_t>::max())
+	{
+		return;
+	}
+
+	const FrameQueries& frame = m_frameQueries[frameIndex];
+	const RecordedZone& zone = frame.zones[zoneIndex];
+
+	if (zone.pipelineStatisticsIndex.has_value())
+	{
+		vkCmdEndQuery(commandBuffer, frame.pipelineStatisticsQueryPool, zone.pipelineStatisticsIndex.value());
+	}
+
+	vkCmdWriteTimestamp(commandBuffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, frame.timestampQueryPool, zone.endTimestampIndex);
+}
+
+void GPUProfiler::Initialise(const std::uint32_t frameCount)
+{
+	m_frameQueries.resize(frameCount);
+
+	if (!IsSupported())
+	{
+		return;
+	}
+
+	for (auto& frame : m_frameQueries)
+	{
+		VkQueryPoolCreateInfo timestampQueryPoolCreateInfo{ };
+		timestampQueryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+		timestampQueryPoolCreateInfo.queryType = VK_QUERY_TYPE_TIMESTAMP;
+		timestampQueryPoolCreateInfo.queryCount = s_MaxZonesPerFrame * 2u;
+
+		if (vkCreateQueryPool(m_vulkanContext.GetLogicalDevice(), &timestampQueryPoolCreateInfo, nullptr, &frame.timestampQueryPool) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Failed to create Vulkan timestamp query pool.");
+		}
+
+		if (SupportsPipelineStatistics())
+		{
+			VkQueryPoolCreateInfo pipelineStatisticsQueryPoolCreateInfo{ };
+			pipelineStatisticsQueryPoolCreateInfo.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+			pipelineStatisticsQueryPoolCreateInfo.queryType = VK_QUERY_TYPE_PIPELINE_STATISTICS;
+			pipelineStatisticsQueryPoolCreateInfo.queryCount = s_MaxZonesPerFrame;
+			pipelineStatisticsQueryPoolCreateInfo.pipelineStatistics = s_PipelineStatisticFlags;
+
+			if (vkCreateQueryPool(m_vulkanContext.GetLogicalDevice(), &pipelineStatisticsQueryPoolCreateInfo, nullptr, &frame.pipelineStatisticsQueryPool) != VK_SUCCESS)
+			{
+				throw std::runtime_error("Failed to create Vulkan pipeline statistics query pool.");
+			}
+		}
+	}
+}
+
+void GPUProfiler::Destroy() noexcept
+{
+	for (auto& frame : m_frameQueries)
+	{
+		if (frame.pipelineStatisticsQueryPool != VK_NULL_HANDLE)
+		{
+			vkDestroyQueryPool(m_vulkanContext.GetLogicalDevice(), frame.pipelineStatisticsQueryPool, nullptr);
+			frame.pipelineStatisticsQueryPool = VK_NULL_HANDLE;
+		}
+
+		if (frame.timestampQueryPool != VK_NULL_HANDLE)
+		{
+			vkDestroyQueryPool(m_vulkanContext.GetLogicalDevice(), frame.timestampQueryPool, nullptr);
+			frame.timestampQueryPool = VK_NULL_HANDLE;
+		}
+	}
+}
+
+void GPUProfiler::ResolveFrame(FrameQueries& frame)
+{
+	if (frame.zones.empty())
+	{
+		return;
+	}
+
+	const std::uint32_t timestampCount = static_cast<std::uint32_t>(frame.zones.size()) * 2u;
+	std::vector<std::uint64_t> timestamps(timestampCount);
+
+	if (vkGetQueryPoolResults(m_vulkanContext.GetLogicalDevice(), frame.timestampQueryPool, 0, timestampCount, timestamps.size() * sizeof(std::uint64_t), timestamps.data(), sizeof(std::uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+	{
+		return;
+	}
+
+	std::vector<std::uint64_t> pipelineStatistics(static_cast<std::size_t>(frame.pipelineStatisticsQueryCount) * s_PipelineStatisticCount);
+
+	if (frame.pipelineStatisticsQueryCount > 0u
+		&& vkGetQueryPoolResults(m_vulkanContext.GetLogicalDevice(), frame.pipelineStatisticsQueryPool, 0, frame.pipelineStatisticsQueryCount, pipelineStatistics.size() * sizeof(std::uint64_t), pipelineStatistics.data(), s_PipelineStatisticCount * sizeof(std::uint64_t), VK_QUERY_RESULT_64_BIT) != VK_SUCCESS)
+	{
+		pipelineStatistics.clear();
+	}
+
+	const std::uint32_t timestampValidBits = m_vulkanContext.GetTimestampValidBits();
+	const std::uint64_t timestampMask = timestampValidBits >= 64u ? std::numeric_limits<std::uint64_t>::max() : (std::uint64_t{ 1u } << timestampValidBits) - 1u;
+	const double nanosecondsPerTick = static_cast<double>(m_vulkanContext.GetTimestampPeriod());
+
+	std::vector<ZoneResult> results;
+	results.reserve(frame.zones.size());
+
+	std::vector<Profiler::Event> events;
+	events.reserve(frame.zones.size());
+
+	std::int64_t earliestBeginNanoseconds = std::numeric_limits<std::int64_t>::max();
+
+	for (const auto& zone : frame.zones)
+	{
+		const std::uint64_t beginTicks = timestamps[zone.beginTimestampIndex] & timestampMask;
+		const std::uint64_t endTicks = timestamps[zone.endTimestampIndex] & timestampMask;
+
+		const std::int64_t beginNanoseconds = static_cast<std::int64_t>(static_cast<double>(beginTicks) * nanosecondsPerTick);
+		const std::int64_t endNanoseconds = static_cast<std::int64_t>(static_cast<double>(std::max(beginTicks, endTicks)) * nanosecondsPerTick);
+		earliestBeginNanoseconds = std::min(earliestBeginNanoseconds, beginNanoseconds);
+
+		ZoneResult result{ };
+		result.name = zone.name;
+		result.durationMilliseconds = static_cast<double>(endNanoseconds - beginNanoseconds) / 1'000'000.0;
+
+		if (zone.pipelineStatisticsIndex.has_value() && !pipelineStatistics.empty())
+		{
+			const std::uint64_t* const statistics = pipelineStatistics.data() + zone.pipelineStatisticsIndex.value() * s_PipelineStatisticCount;
+
+			result.pipelineStatistics = PipelineStatistics{
+				.inputAssemblyVertices = statistics[0],
+				.inputAssemblyPrimitives = statistics[1],
+				.vertexShaderInvocations = statistics[2],
+				.clippingInvocations = statistics[3],
+				.clippingPrimitives = statistics[4],
+				.fragmentShaderInvocations = statistics[5]
+			};
+		}
+
+		results.push_back(result);
+		events.push_back(Profiler::Event{ zone.name, static_cast<std::uint64_t>(beginNanoseconds), static_cast<std::uint64_t>(endNanoseconds) });
+	}
+
+	m_latestResults = std::move(results);
+
+#ifdef ENABLE_PROFILER
+	const std::int64_t timestampOffset = static_cast<std::int64_t>(frame.submissionTimestamp) - earliestBeginNanoseconds;
+	m_gpuToCPUTimestampOffset = std::max(m_gpuToCPUTimestampOffset.value_or(timestampOffset), timestampOffset);
+
+	for (auto& event : events)
+	{
+		event.startNanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(static_cast<std::int64_t>(event.startNanoseconds) + m_gpuToCPUTimestampOffset.value(), 0));
+		event.endNanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(static_cast<std::int64_t>(event.endNanoseconds) + m_gpuToCPUTimestampOffset.value(), 0));
+	}
+
+	if (!m_profilerTrackID.has_value())
+	{
+		m_profilerTrackID = Profiler::Get().CreateTrack("GPU");
+	}
+
+	Profiler::Get().RecordTrackEvents(m_profilerTrackID.value(), events);
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "../../utility/interfaces/INoncopyable.h"
+#include "../../utility/interfaces/INonmovable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+#include "../../utility/Profiler.h"
+#include "VulkanContext.h"
+
+#ifdef ENABLE_PROFILER
+	#define PROFILE_GPU_SCOPE(renderer, name) const GPUProfiler::Zone PROFILE_CONCATENATE(gpuProfileZone, __LINE__)(renderer, name)
+#else
+	#define PROFILE_GPU_SCOPE(renderer, name) static_cast<void>(0)
+#endif
+
+class GPUProfiler
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct PipelineStatistics
+	{
+		std::uint64_t inputAssemblyVertices = 0u;
+		std::uint64_t inputAssemblyPrimitives = 0u;
+		std::uint64_t vertexShaderInvocations = 0u;
+		std::uint64_t clippingInvocations = 0u;
+		std::uint64_t clippingPrimitives = 0u;
+		std::uint64_t fragmentShaderInvocations = 0u;
+	};
+
+	struct ZoneResult
+	{
+		const char* name = nullptr;
+		double durationMilliseconds = 0.0;
+
+		std::optional<PipelineStatistics> pipelineStatistics = std::nullopt;
+	};
+
+	// Zone names must outlive the frame they are recorded in, as results are only resolved once the GPU has finished with it.
+	class Zone
+		: private INoncopyable, private INonmovable
+	{
+	private:
+		class Renderer& m_renderer;
+
+	public:
+		Zone(class Renderer& renderer, const char* name);
+		~Zone() noexcept;
+	};
+
+private:
+	static constexpr std::uint32_t s_MaxZonesPerFrame = 32u;
+
+	static constexpr VkQueryPipelineStatisticFlags s_PipelineStatisticFlags = VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_VERTICES_BIT
+		| VK_QUERY_PIPELINE_STATISTIC_INPUT_ASSEMBLY_PRIMITIVES_BIT
+		| VK_QUERY_PIPELINE_STATISTIC_VERTEX_SHADER_INVOCATIONS_BIT
+		| VK_QUERY_PIPELINE_STATISTIC_CLIPPING_INVOCATIONS_BIT
+		| VK_QUERY_PIPELINE_STATISTIC_CLIPPING_PRIMITIVES_BIT
+		| VK_QUERY_PIPELINE_STATISTIC_FRAGMENT_SHADER_INVOCATIONS_BIT;
+	static constexpr std::uint32_t s_PipelineStatisticCount = 6u;
+
+	struct RecordedZone
+	{
+		const char* name = nullptr;
+
+		std::uint32_t beginTimestampIndex = 0u;
+		std::uint32_t endTimestampIndex = 0u;
+		std::optional<std::uint32_t> pipelineStatisticsIndex = std::nullopt;
+	};
+
+	struct FrameQueries
+	{
+		VkQueryPool timestampQueryPool = VK_NULL_HANDLE;
+		VkQueryPool pipelineStatisticsQueryPool = VK_NULL_HANDLE;
+
+		std::vector<RecordedZone> zones;
+		std::uint32_t pipelineStatisticsQueryCount = 0u;
+
+		std::uint64_t submissionTimestamp = 0u;
+		bool isSubmitted = false;
+	};
+
+	const VulkanContext& m_vulkanContext;
+
+	std::vector<FrameQueries> m_frameQueries;
+	std::vector<std::size_t> m_openZoneIndices;
+
+	std::vector<ZoneResult> m_latestResults;
+
+	std::optional<std::int64_t> m_gpuToCPUTimestampOffset = std::nullopt;
+	std::optional<std::uint32_t> m_profilerTrackID = std::nullopt;
+
+public:
+	GPUProfiler(const VulkanContext& vulkanContext, const std::uint32_t frameCount);
+	~GPUProfiler() noexcept;
+
+	void BeginFrame(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex);
+	void EndFrame(const std::uint32_t frameIndex);
+
+	void BeginZone(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex, const char* name);
+	void EndZone(const VkCommandBuffer commandBuffer, const std::uint32_t frameIndex);
+
+	inline bool IsSupported() const noexcept
+	{
+#ifdef ENABLE_PROFILER
+		return m_vulkanContext.SupportsTimestampQueries();
+#else
+		return false;
+#endif
+	}
+
+	inline bool SupportsPipelineStatistics() const noexcept { return IsSupported() && m_vulkanContext.SupportsPipelineStatisticsQueries(); }
+	static constexpr VkQueryPipelineStatisticFlags GetPipelineStatisticFlags() noexcept { return s_PipelineStatisticFlags; }
+
+	inline const std::vector<ZoneResult>& GetLatestResults() const noexcept { return m_latestResults; }
+
+private:
+	void Initialise(const std::uint32_t frameCount);
+	void Destroy() noexcept;
+
+	void ResolveFrame(FrameQueries& frame);
+};
\ No newline at end of file
@@ -3,42 +3,59 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <functional>
+#include <iostream>
+#include <iterator>
 #include <limits>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 
 #include <SDL2/SDL.h>
 
 #include "VulkanUtility.h"
+#include "../../utility/Profiler.h"
 
 Renderer::Renderer(const Window& window)
-	: m_window(window), m_vulkanContext(m_window)
+	: m_window(&window), m_vulkanContext(window), m_recordingThreadPool(std::thread::hardware_concurrency()), m_gpuProfiler(m_vulkanContext, static_cast<std::uint32_t>(s_MaxFramesInFlight))
 {
-	InitialisePipelineCache();
-	InitialiseSynchronisationPrimitives();
+	Initialise();
+}
 
-	InitialiseSwapchain();
-	InitialiseRenderPass();
-	InitialiseDepthStencilBuffer();
-	InitialiseFramebuffers();
-	AllocateCommandBuffers();
+Renderer::Renderer(const VkExtent2D& headlessExtent)
+	: m_vulkanContext(), m_recordingThreadPool(std::thread::hardware_concurrency()), m_gpuProfiler(m_vulkanContext, static_cast<std::uint32_t>(s_MaxFramesInFlight)), m_swapchainExtent(headlessExtent)
+{
+	Initialise();
 }
 
 Renderer::~Renderer() noexcept
 {
 	CleanupPresentationObjects();
 
-	DestroySynchronisationPrimitives();
+	DestroyFrameResources();
+
+	SavePipelineCache();
 	DestroyPipelineCache();
 }
 
 bool Renderer::PrepareRender()
 {
-	vkWaitForFences(m_vulkanContext.GetLogicalDevice(), 1, &m_perFrameSynchronisation[m_currentFrameInFlight].inFlightFence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
-	vkResetFences(m_vulkanContext.GetLogicalDevice(), 1, &m_perFrameSynchronisation[m_currentFrameInFlight].inFlightFence);
+	PROFILE_SCOPE("Renderer::PrepareRender");
+
+	FrameResources& currentFrame = m_frameResources[m_currentFrameIndex];
+
+	vkWaitForFences(m_vulkanContext.GetLogicalDevice(), 1, &currentFrame.inFlightFence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+	FlushDeletionQueue(currentFrame);
+	vmaSetCurrentFrameIndex(m_vulkanContext.GetAllocator(), ++m_allocatorFrameIndex);
 
-	if (const VkResult imageAcquisitionResult = vkAcquireNextImageKHR(m_vulkanContext.GetLogicalDevice(), m_swapchain, std::numeric_limits<std::uint64_t>::max(), m_perFrameSynchronisation[m_currentFrameInFlight].imageAvailableSemaphore, VK_NULL_HANDLE, &m_nextAcquiredImageIndex);
+	if (IsHeadless())
+	{
+		m_nextAcquiredImageIndex = m_currentFrameIndex;
+	}
+	else if (const VkResult imageAcquisitionResult = vkAcquireNextImageKHR(m_vulkanContext.GetLogicalDevice(), m_swapchain, std::numeric_limits<std::uint64_t>::max(), currentFrame.imageAvailableSemaphore, VK_NULL_HANDLE, &m_nextAcquiredImageIndex);
 		imageAcquisitionResult == VK_ERROR_OUT_OF_DATE_KHR)
 	{
 		RecreatePresentationObjects();
@@ -50,21 +67,30 @@ bool Renderer::PrepareRender()
 		throw std::runtime_error("Failed to acquire next Vulkan swapchain image.");
 	}
 
-	return true;
-}
+	vkResetFences(m_vulkanContext.GetLogicalDevice(), 1, &currentFrame.inFlightFence);
+
+	if (vkResetCommandPool(m_vulkanContext.GetLogicalDevice(), currentFrame.commandPool, 0) != VK_SUCCESS)
+	{
+		throw std::runtime_error("Failed to reset Vulkan frame command pool.");
+	}
 
-void Renderer::BeginRender(const glm::vec4& clearColour)
-{
 	VkCommandBufferBeginInfo commandBufferBeginInfo{ };
 	commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
-	commandBufferBeginInfo.flags = 0;
+	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
 	commandBufferBeginInfo.pInheritanceInfo = nullptr;
 
-	if (vkBeginCommandBuffer(m_commandBuffers[m_nextAcquiredImageIndex], &commandBufferBeginInfo) != VK_SUCCESS)
+	if (vkBeginCommandBuffer(currentFrame.commandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
 	{
 		throw std::runtime_error("Failed to begin recording Vulkan command buffer.");
 	}
 
+	m_gpuProfiler.BeginFrame(currentFrame.commandBuffer, m_currentFrameIndex);
+
+	return true;
+}
+
+void Renderer::BeginRender(const glm::vec4& clearColour, const VkSubpassContents subpassContents)
+{
 	VkRenderPassBeginInfo renderPassBeginInfo{ };
 	renderPassBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
 	renderPassBeginInfo.renderPass = m_renderPass;
@@ -81,42 +107,79 @@ void Renderer::BeginRender(const glm::vec4& clearColour)
 	renderPassBeginInfo.clearValueCount = static_cast<std::uint32_t>(clearValues.size());
 	renderPassBeginInfo.pClearValues = clearValues.data();
 
-	vkCmdBeginRenderPass(m_commandBuffers[m_nextAcquiredImageIndex], &renderPassBeginInfo, VK_SUBPASS_CONTENTS_INLINE);
+	for (const auto& recordFunction : m_deferredTransferCommands)
+	{
+		recordFunction(m_frameResources[m_currentFrameIndex].commandBuffer);
+	}
+
+	m_deferredTransferCommands.clear();
+
+	vkCmdBeginRenderPass(m_frameResources[m_currentFrameIndex].commandBuffer, &renderPassBeginInfo, subpassContents);
 }
 
 void Renderer::EndRender()
 {
-	vkCmdEndRenderPass(m_commandBuffers[m_nextAcquiredImageIndex]);
+	PROFILE_SCOPE("Renderer::EndRender");
+
+	vkCmdEndRenderPass(m_frameResources[m_currentFrameIndex].commandBuffer);
+}
+
+void Renderer::Present()
+{
+	PROFILE_SCOPE("Renderer::Present");
+
+	FrameResources& currentFrame = m_frameResources[m_currentFrameIndex];
+	m_gpuProfiler.EndFrame(m_currentFrameIndex);
 
-	if (vkEndCommandBuffer(m_commandBuffers[m_nextAcquiredImageIndex]) != VK_SUCCESS)
+	if (vkEndCommandBuffer(currentFrame.commandBuffer) != VK_SUCCESS)
 	{
 		throw std::runtime_error("Failed to record Vulkan command buffer.");
 	}
 
 	VkSubmitInfo submitInfo{ };
 	submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-	submitInfo.waitSemaphoreCount = 1;
-	submitInfo.pWaitSemaphores = &m_perFrameSynchronisation[m_currentFrameInFlight].imageAvailableSemaphore;
+	submitInfo.waitSemaphoreCount = IsHeadless() ? 0 : 1;
+	submitInfo.pWaitSemaphores = IsHeadless() ? nullptr : &currentFrame.imageAvailableSemaphore;
 
 	const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 	submitInfo.pWaitDstStageMask = &waitStage;
 	submitInfo.commandBufferCount = 1;
-	submitInfo.pCommandBuffers = &m_commandBuffers[m_nextAcquiredImageIndex];
-	submitInfo.signalSemaphoreCount = 1;
-	submitInfo.pSignalSemaphores = &m_perFrameSynchronisation[m_currentFrameInFlight].renderFinishedSemaphore;
+	submitInfo.pCommandBuffers = &currentFrame.commandBuffer;
+	submitInfo.signalSemaphoreCount = IsHeadless() ? 0 : 1;
+	submitInfo.pSignalSemaphores = IsHeadless() ? nullptr : &currentFrame.renderFinishedSemaphore;
 
-	if (vkQueueSubmit(m_vulkanContext.GetGraphicsQueue(), 1, &submitInfo, m_perFrameSynchronisation[m_currentFrameInFlight].inFlightFence) != VK_SUCCESS)
+	if (vkQueueSubmit(m_vulkanContext.GetGraphicsQueue(), 1, &submitInfo, currentFrame.inFlightFence) != VK_SUCCESS)
 	{
 		throw std::runtime_error("Failed to submit Vulkan draw command buffer.");
 	}
-}
 
-void Renderer::Present()
-{
+	m_lastSubmittedFrameIndex = m_currentFrameIndex;
+	m_hasSubmittedFrame = true;
+
+	std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> memoryHeapBudgets{ };
+	vmaGetBudget(m_vulkanContext.GetAllocator(), memoryHeapBudgets.data());
+
+	VkDeviceSize allocatedBytes = 0;
+
+	for (const auto& memoryHeapBudget : memoryHeapBudgets)
+	{
+		allocatedBytes += memoryHeapBudget.allocationBytes;
+	}
+
+	m_frameStatistics.Set(FrameStatistics::Statistic::AllocatedBytes, allocatedBytes);
+	m_frameStatistics.EndFrame();
+
+	if (IsHeadless())
+	{
+		m_currentFrameIndex = (m_currentFrameIndex + 1) % s_MaxFramesInFlight;
+
+		return;
+	}
+
 	VkPresentInfoKHR presentationInfo{ };
 	presentationInfo.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
 	presentationInfo.waitSemaphoreCount = 1;
-	presentationInfo.pWaitSemaphores = &m_perFrameSynchronisation[m_currentFrameInFlight].renderFinishedSemaphore;
+	presentationInfo.pWaitSemaphores = &currentFrame.renderFinishedSemaphore;
 	presentationInfo.swapchainCount = 1;
 	presentationInfo.pSwapchains = &m_swapchain;
 	presentationInfo.pImageIndices = &m_nextAcquiredImageIndex;
@@ -133,7 +196,7 @@ void Renderer::Present()
 		throw std::runtime_error("Failed to present next Vulkan swapchain image.");
 	}
 
-	m_currentFrameInFlight = (m_currentFrameInFlight + 1) % s_MaxFramesInFlight;
+	m_currentFrameIndex = (m_currentFrameIndex + 1) % s_MaxFramesInFlight;
 }
 
 void Renderer::FinaliseRenderOperations() const noexcept
@@ -141,9 +204,216 @@ void Renderer::FinaliseRenderOperations() const noexcept
 	m_vulkanContext.WaitOnLogicalDevice();
 }
 
+void Renderer::CaptureFrame(const std::string& ppmFilepath) const
+{
+	if (!IsHeadless())
+	{
+		throw std::runtime_error("Frame capture is only supported by the headless renderer.");
+	}
+
+	if (!m_hasSubmittedFrame)
+	{
+		throw std::runtime_error("Cannot capture a frame before one has been rendered.");
+	}
+
+	vkWaitForFences(m_vulkanContext.GetLogicalDevice(), 1, &m_frameResources[m_lastSubmittedFrameIndex].inFlightFence, VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+
+	const VkDeviceSize readbackSize = static_cast<VkDeviceSize>(m_swapchainExtent.width) * m_swapchainExtent.height * 4u;
+
+	VkBuffer readbackBuffer = VK_NULL_HANDLE;
+	VmaAllocation readbackAllocation = VK_NULL_HANDLE;
+	vulkan_util::CreateBuffer(m_vulkanContext, readbackSize, VK_BUFFER_USAGE_TRANSFER_DST_BIT, VMA_MEMORY_USAGE_GPU_TO_CPU, MemoryTracker::Category::ReadbackBuffers, readbackBuffer, readbackAllocation);
+
+	VkBufferImageCopy bufferImageCopy{ };
+	bufferImageCopy.bufferOffset = 0;
+	bufferImageCopy.bufferRowLength = 0;
+	bufferImageCopy.bufferImageHeight = 0;
+	bufferImageCopy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+	bufferImageCopy.imageSubresource.mipLevel = 0;
+	bufferImageCopy.imageSubresource.baseArrayLayer = 0;
+	bufferImageCopy.imageSubresource.layerCount = 1;
+	bufferImageCopy.imageOffset = VkOffset3D{ 0, 0, 0 };
+	bufferImageCopy.imageExtent = VkExtent3D{ m_swapchainExtent.width, m_swapchainExtent.height, 1 };
+
+	try
+	{
+		VkCommandBuffer commandBuffer = vulkan_util::BeginSingleTimeCommands(m_vulkanContext);
+		vkCmdCopyImageToBuffer(commandBuffer, m_swapchainImages[m_lastSubmittedFrameIndex], VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, readbackBuffer, 1, &bufferImageCopy);
+		vulkan_util::EndSingleTimeCommands(m_vulkanContext, commandBuffer);
+	}
+	catch (...)
+	{
+		vulkan_util::DestroyBuffer(m_vulkanContext, readbackBuffer, readbackAllocation);
+
+		throw;
+	}
+
+	void* readbackData = nullptr;
+
+	if (vmaMapMemory(m_vulkanContext.GetAllocator(), readbackAllocation, &readbackData) != VK_SUCCESS)
+	{
+		vulkan_util::DestroyBuffer(m_vulkanContext, readbackBuffer, readbackAllocation);
+
+		throw std::runtime_error("Failed to map Vulkan frame capture memory.");
+	}
+
+	vmaInvalidateAllocation(m_vulkanContext.GetAllocator(), readbackAllocation, 0, VK_WHOLE_SIZE);
+
+	const std::size_t pixelCount = static_cast<std::size_t>(m_swapchainExtent.width) * m_swapchainExtent.height;
+	const auto* const rgbaPixels = static_cast<const char*>(readbackData);
+	std::vector<char> rgbPixels(pixelCount * 3u);
+
+	for (std::size_t i = 0; i < pixelCount; ++i)
+	{
+		std::memcpy(rgbPixels.data() + i * 3u, rgbaPixels + i * 4u, 3u);
+	}
+
+	vmaUnmapMemory(m_vulkanContext.GetAllocator(), readbackAllocation);
+	vulkan_util::DestroyBuffer(m_vulkanContext, readbackBuffer, readbackAllocation);
+
+	std::ofstream ppmFile(ppmFilepath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+	ppmFile << "P6\n" << m_swapchainExtent.width << " " << m_swapchainExtent.height << "\n255\n";
+	ppmFile.write(rgbPixels.data(), static_cast<std::streamsize>(rgbPixels.size()));
+
+	if (!ppmFile)
+	{
+		throw std::runtime_error("Failed to write frame capture \"" + ppmFilepath + "\".");
+	}
+}
+
+void Renderer::ExecuteSecondaryCommandBuffers(const std::uint32_t taskCount, const std::function<bool(std::uint32_t)>& updateFunction, const std::function<void(std::uint32_t)>& recordFunction)
+{
+	if (taskCount > m_recordingThreadPool.GetThreadCount())
+	{
+		throw std::invalid_argument("Secondary command buffer task count exceeds the number of recording threads.");
+	}
+
+	FrameResources& currentFrame = m_frameResources[m_currentFrameIndex];
+
+	if (currentFrame.recordedSecondaryTaskCount != taskCount)
+	{
+		std::fill(std::begin(currentFrame.secondaryRecordedFlags), std::end(currentFrame.secondaryRecordedFlags), 0u);
+		currentFrame.recordedSecondaryTaskCount = taskCount;
+	}
+
+	m_recordingThreadPool.ParallelFor(taskCount, [this, &currentFrame, &updateFunction, &recordFunction](const std::size_t taskIndex)
+	{
+		const bool isRecordingStale = updateFunction(static_cast<std::uint32_t>(taskIndex));
+
+		if (currentFrame.secondaryRecordedFlags[taskIndex] != 0u && !isRecordingStale)
+		{
+			return;
+		}
+
+		currentFrame.secondaryRecordedFlags[taskIndex] = 0u;
+		currentFrame.recordedSecondaryStatistics[taskIndex] = FrameStatistics::Values{ };
+
+		const VkCommandBuffer secondaryCommandBuffer = currentFrame.secondaryCommandBuffers[taskIndex];
+		BeginSecondaryCommandBuffer(secondaryCommandBuffer);
+
+		s_currentSecondaryCommandBuffer = secondaryCommandBuffer;
+		s_currentSecondaryStatistics = &currentFrame.recordedSecondaryStatistics[taskIndex];
+
+		try
+		{
+			recordFunction(static_cast<std::uint32_t>(taskIndex));
+		}
+		catch (...)
+		{
+			s_currentSecondaryCommandBuffer = VK_NULL_HANDLE;
+			s_currentSecondaryStatistics = nullptr;
+
+			throw;
+		}
+
+		s_currentSecondaryCommandBuffer = VK_NULL_HANDLE;
+		s_currentSecondaryStatistics = nullptr;
+
+		if (vkEndCommandBuffer(secondaryCommandBuffer) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Failed to record Vulkan secondary command buffer.");
+		}
+
+		currentFrame.secondaryRecordedFlags[taskIndex] = 1u;
+	});
+
+	for (std::uint32_t i = 0; i < taskCount; ++i)
+	{
+		m_frameStatistics.Add(currentFrame.recordedSecondaryStatistics[i]);
+	}
+
+	if (taskCount > 0)
+	{
+		vkCmdExecuteCommands(currentFrame.commandBuffer, taskCount, currentFrame.secondaryCommandBuffers.data());
+	}
+}
+
+void Renderer::InvalidateSecondaryCommandBuffers() noexcept
+{
+	for (auto& frame : m_frameResources)
+	{
+		frame.recordedSecondaryTaskCount = 0;
+	}
+}
+
+void Renderer::WaitForFramesInFlight() const
+{
+	std::array<VkFence, s_MaxFramesInFlight> inFlightFences{ };
+
+	for (std::size_t i = 0; i < s_MaxFramesInFlight; ++i)
+	{
+		inFlightFences[i] = m_frameResources[i].inFlightFence;
+	}
+
+	vkWaitForFences(m_vulkanContext.GetLogicalDevice(), static_cast<std::uint32_t>(inFlightFences.size()), inFlightFences.data(), VK_TRUE, std::numeric_limits<std::uint64_t>::max());
+}
+
+void Renderer::DeferDeletion(std::function<void()> deleter) const
+{
+	m_frameResources[m_lastSubmittedFrameIndex].deletionQueue.push_back(std::move(deleter));
+}
+
+void Renderer::DeferTransferCommands(std::function<void(VkCommandBuffer)> recordFunction)
+{
+	m_deferredTransferCommands.push_back(std::move(recordFunction));
+}
+
+void Renderer::RecordStatistic(const FrameStatistics::Statistic statistic, const std::uint64_t amount) const noexcept
+{
+	if (s_currentSecondaryStatistics != nullptr)
+	{
+		(*s_currentSecondaryStatistics)[static_cast<std::size_t>(statistic)] += amount;
+	}
+	else
+	{
+		m_frameStatistics.Add(statistic, amount);
+	}
+}
+
+void Renderer::BeginGPUZone(const char* name)
+{
+	if (s_currentSecondaryCommandBuffer != VK_NULL_HANDLE)
+	{
+		throw std::logic_error("GPU profiler zones cannot be recorded into secondary command buffers.");
+	}
+
+	m_gpuProfiler.BeginZone(m_frameResources[m_currentFrameIndex].commandBuffer, m_currentFrameIndex, name);
+}
+
+void Renderer::EndGPUZone()
+{
+	if (s_currentSecondaryCommandBuffer != VK_NULL_HANDLE)
+	{
+		throw std::logic_error("GPU profiler zones cannot be recorded into secondary command buffers.");
+	}
+
+	m_gpuProfiler.EndZone(m_frameResources[m_currentFrameIndex].commandBuffer, m_currentFrameIndex);
+}
+
 void Renderer::BindPipeline(const GraphicsPipeline& pipeline)
 {
-	vkCmdBindPipeline(m_commandBuffers[m_nextAcquiredImageIndex], VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetHandle());
+	vkCmdBindPipeline(GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetHandle());
+	RecordStatistic(FrameStatistics::Statistic::PipelineBinds);
 
 	VkViewport viewport{ };
 	viewport.x = 0.0f;
@@ -153,39 +423,67 @@ void Renderer::BindPipeline(const GraphicsPipeline& pipeline)
 	viewport.minDepth = 0.0f;
 	viewport.maxDepth = 1.0f;
 
-	vkCmdSetViewport(m_commandBuffers[m_nextAcquiredImageIndex], 0, 1, &viewport);
+	vkCmdSetViewport(GetCurrentCommandBuffer(), 0, 1, &viewport);
 
 	VkRect2D scissor{ };
 	scissor.offset = VkOffset2D{ 0, 0 };
 	scissor.extent = m_swapchainExtent;
 
-	vkCmdSetScissor(m_commandBuffers[m_nextAcquiredImageIndex], 0, 1, &scissor);
+	vkCmdSetScissor(GetCurrentCommandBuffer(), 0, 1, &scissor);
 }
 
 void Renderer::BindVertexBuffer(const VertexBuffer& vertexBuffer)
 {
 	const VkDeviceSize offset = 0;
-	vkCmdBindVertexBuffers(m_commandBuffers[m_nextAcquiredImageIndex], 0, 1, &vertexBuffer.GetHandle(), &offset);
+	vkCmdBindVertexBuffers(GetCurrentCommandBuffer(), 0, 1, &vertexBuffer.GetHandle(), &offset);
+	RecordStatistic(FrameStatistics::Statistic::BufferBinds);
 }
 
 void Renderer::BindIndexBuffer(const IndexBuffer& indexBuffer)
 {
-	vkCmdBindIndexBuffer(m_commandBuffers[m_nextAcquiredImageIndex], indexBuffer.GetHandle(), 0, indexBuffer.GetIndexType());
+	vkCmdBindIndexBuffer(GetCurrentCommandBuffer(), indexBuffer.GetHandle(), 0, indexBuffer.GetIndexType());
+	RecordStatistic(FrameStatistics::Statistic::BufferBinds);
 }
 
-void Renderer::BindDescriptorSet(const GraphicsPipeline& pipeline)
+void Renderer::BindDescriptorSet(const GraphicsPipeline& pipeline, const std::uint32_t uniformBlockIndex)
 {
-	vkCmdBindDescriptorSets(m_commandBuffers[m_nextAcquiredImageIndex], VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetLayout(), 0, 1, &pipeline.GetDescriptorSets()[m_nextAcquiredImageIndex], 0, nullptr);
+	std::array<std::uint32_t, GraphicsPipeline::GetMaxDynamicOffsetCount()> dynamicOffsets{ };
+	std::fill_n(std::begin(dynamicOffsets), pipeline.GetDynamicOffsetCount(), pipeline.GetUniformBlockOffset(m_currentFrameIndex, uniformBlockIndex));
+
+	vkCmdBindDescriptorSets(GetCurrentCommandBuffer(), VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline.GetLayout(), 0, static_cast<std::uint32_t>(pipeline.GetDescriptorSets().size()), pipeline.GetDescriptorSets().data(), pipeline.GetDynamicOffsetCount(), dynamicOffsets.data());
+	pipeline.GetShaderProgram()->MarkDescriptorSetsBound();
 }
 
 void Renderer::Draw(const std::uint32_t vertexCount)
 {
-	vkCmdDraw(m_commandBuffers[m_nextAcquiredImageIndex], vertexCount, 1, 0, 0);
+	vkCmdDraw(GetCurrentCommandBuffer(), vertexCount, 1, 0, 0);
+	RecordStatistic(FrameStatistics::Statistic::DrawCalls);
 }
 
 void Renderer::DrawIndexed(const std::uint32_t indexCount)
 {
-	vkCmdDrawIndexed(m_commandBuffers[m_nextAcquiredImageIndex], indexCount, 1, 0, 0, 0);
+	vkCmdDrawIndexed(GetCurrentCommandBuffer(), indexCount, 1, 0, 0, 0);
+	RecordStatistic(FrameStatistics::Statistic::DrawCalls);
+}
+
+void Renderer::DrawIndexedIndirect(const IndirectBuffer& indirectBuffer, const std::uint32_t regionIndex)
+{
+	const VkDeviceSize regionOffset = indirectBuffer.GetRegionOffset(regionIndex);
+
+	if (m_vulkanContext.SupportsMultiDrawIndirect())
+	{
+		vkCmdDrawIndexedIndirect(GetCurrentCommandBuffer(), indirectBuffer.GetHandle(), regionOffset, indirectBuffer.GetCommandCount(), sizeof(VkDrawIndexedIndirectCommand));
+		RecordStatistic(FrameStatistics::Statistic::DrawCalls);
+	}
+	else
+	{
+		for (std::uint32_t i = 0; i < indirectBuffer.GetCommandCount(); ++i)
+		{
+			vkCmdDrawIndexedIndirect(GetCurrentCommandBuffer(), indirectBuffer.GetHandle(), regionOffset + i * sizeof(VkDrawIndexedIndirectCommand), 1, sizeof(VkDrawIndexedIndirectCommand));
+		}
+
+		RecordStatistic(FrameStatistics::Statistic::DrawCalls, indirectBuffer.GetCommandCount());
+	}
 }
 
 void Renderer::ProcessWindowResize()
@@ -193,12 +491,26 @@ void Renderer::ProcessWindowResize()
 	m_hasFramebufferResized = true;
 }
 
+void Renderer::Initialise()
+{
+	InitialisePipelineCache();
+	InitialiseFrameResources();
+
+	InitialiseSwapchain();
+	InitialiseRenderPass();
+	InitialiseDepthStencilBuffer();
+	InitialiseFramebuffers();
+}
+
 void Renderer::InitialisePipelineCache()
 {
+	const std::vector<std::byte> pipelineCacheData = LoadPipelineCacheData();
+	m_hasWarmPipelineCache = !pipelineCacheData.empty();
+
 	VkPipelineCacheCreateInfo pipelineCacheCreateInfo{ };
 	pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-	pipelineCacheCreateInfo.initialDataSize = 0;
-	pipelineCacheCreateInfo.pInitialData = nullptr;
+	pipelineCacheCreateInfo.initialDataSize = pipelineCacheData.size();
+	pipelineCacheCreateInfo.pInitialData = m_hasWarmPipelineCache ? pipelineCacheData.data() : nullptr;
 
 	if (vkCreatePipelineCache(m_vulkanContext.GetLogicalDevice(), &pipelineCacheCreateInfo, nullptr, &m_pipelineCache) != VK_SUCCESS)
 	{
@@ -206,6 +518,107 @@ void Renderer::InitialisePipelineCache()
 	}
 }
 
+[[nodiscard]] std::vector<std::byte> Renderer::LoadPipelineCacheData() const
+{
+	std::ifstream pipelineCacheFile(s_PipelineCacheFilepath, std::ios_base::in | std::ios_base::ate | std::ios_base::binary);
+
+	if (!pipelineCacheFile.is_open())
+	{
+		return { };
+	}
+
+	std::vector<std::byte> pipelineCacheData(static_cast<std::size_t>(pipelineCacheFile.tellg()));
+	pipelineCacheFile.seekg(0);
+	pipelineCacheFile.read(reinterpret_cast<char*>(pipelineCacheData.data()), static_cast<std::streamsize>(pipelineCacheData.size()));
+
+	if (!pipelineCacheFile || !IsPipelineCacheDataValid(pipelineCacheData))
+	{
+		std::cerr << "Discarding stale or corrupt pipeline cache \"" << s_PipelineCacheFilepath << "\".\n";
+
+		return { };
+	}
+
+	return pipelineCacheData;
+}
+
+[[nodiscard]] bool Renderer::IsPipelineCacheDataValid(const std::vector<std::byte>& pipelineCacheData) const
+{
+	struct PipelineCacheHeader
+	{
+		std::uint32_t headerSize;
+		std::uint32_t headerVersion;
+		std::uint32_t vendorID;
+		std::uint32_t deviceID;
+		std::uint8_t pipelineCacheUUID[VK_UUID_SIZE];
+	};
+
+	if (pipelineCacheData.size() < sizeof(PipelineCacheHeader))
+	{
+		return false;
+	}
+
+	PipelineCacheHeader header{ };
+	std::memcpy(&header, pipelineCacheData.data(), sizeof(PipelineCacheHeader));
+
+	VkPhysicalDeviceProperties physicalDeviceProperties{ };
+	vkGetPhysicalDeviceProperties(m_vulkanContext.GetPhysicalDevice(), &physicalDeviceProperties);
+
+	return header.headerSize >= sizeof(PipelineCacheHeader) && header.headerSize <= pipelineCacheData.size()
+		&& header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE
+		&& header.vendorID == physicalDeviceProperties.vendorID
+		&& header.deviceID == physicalDeviceProperties.deviceID
+		&& std::memcmp(header.pipelineCacheUUID, physicalDeviceProperties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+void Renderer::SavePipelineCache() const noexcept
+{
+	if (m_pipelineCache == VK_NULL_HANDLE)
+	{
+		return;
+	}
+
+	std::size_t pipelineCacheSize = 0;
+
+	if (vkGetPipelineCacheData(m_vulkanContext.GetLogicalDevice(), m_pipelineCache, &pipelineCacheSize, nullptr) != VK_SUCCESS || pipelineCacheSize == 0)
+	{
+		return;
+	}
+
+	try
+	{
+		std::vector<std::byte> pipelineCacheData(pipelineCacheSize);
+
+		if (vkGetPipelineCacheData(m_vulkanContext.GetLogicalDevice(), m_pipelineCache, &pipelineCacheSize, pipelineCacheData.data()) != VK_SUCCESS)
+		{
+			return;
+		}
+
+		const std::filesystem::path pipelineCacheFilepath(s_PipelineCacheFilepath);
+		std::filesystem::path temporaryFilepath = pipelineCacheFilepath;
+		temporaryFilepath += ".tmp";
+
+		{
+			std::ofstream temporaryFile(temporaryFilepath, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+			temporaryFile.write(reinterpret_cast<const char*>(pipelineCacheData.data()), static_cast<std::streamsize>(pipelineCacheSize));
+			temporaryFile.close();
+
+			if (!temporaryFile)
+			{
+				std::filesystem::remove(temporaryFilepath);
+				std::cerr << "Failed to write pipeline cache \"" << s_PipelineCacheFilepath << "\".\n";
+
+				return;
+			}
+		}
+
+		std::filesystem::rename(temporaryFilepath, pipelineCacheFilepath);
+	}
+	catch (const std::exception& error)
+	{
+		std::cerr << "Failed to save pipeline cache: " << error.what() << "\n";
+	}
+}
+
 void Renderer::DestroyPipelineCache() noexcept
 {
 	if (m_pipelineCache != VK_NULL_HANDLE)
@@ -215,9 +628,15 @@ void Renderer::DestroyPipelineCache() noexcept
 	}
 }
 
-void Renderer::InitialiseSynchronisationPrimitives()
+void Renderer::InitialiseFrameResources()
 {
-	m_perFrameSynchronisation.resize(s_MaxFramesInFlight);
+	VkCommandPoolCreateInfo commandPoolCreateInfo{ };
+	commandPoolCreateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+	commandPoolCreateInfo.queueFamilyIndex = m_vulkanContext.GetQueueFamilyIndices().graphicsFamilyIndex.value();
+	commandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+
+	VkCommandPoolCreateInfo secondaryCommandPoolCreateInfo = commandPoolCreateInfo;
+	secondaryCommandPoolCreateInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
 	VkSemaphoreCreateInfo semaphoreCreateInfo{ };
 	semaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
@@ -226,9 +645,47 @@ void Renderer::InitialiseSynchronisationPrimitives()
 	fenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
 	fenceCreateInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
 
-	for (auto& [imageAvailableSemaphore, renderFinishedSemaphore, inFlightFence] : m_perFrameSynchronisation)
+	for (auto& frame : m_frameResources)
 	{
-		const std::array<std::reference_wrapper<VkSemaphore>, 2u> semaphores{ std::ref(imageAvailableSemaphore), std::ref(renderFinishedSemaphore) };
+		if (vkCreateCommandPool(m_vulkanContext.GetLogicalDevice(), &commandPoolCreateInfo, nullptr, &frame.commandPool) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Failed to create Vulkan frame command pool.");
+		}
+
+		VkCommandBufferAllocateInfo commandBufferAllocateInfo{ };
+		commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+		commandBufferAllocateInfo.commandPool = frame.commandPool;
+		commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+		commandBufferAllocateInfo.commandBufferCount = 1;
+
+		if (vkAllocateCommandBuffers(m_vulkanContext.GetLogicalDevice(), &commandBufferAllocateInfo, &frame.commandBuffer) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Failed to allocate Vulkan command buffers.");
+		}
+
+		// Secondary command pools are owned by task slots rather than worker threads: a slot is recorded by exactly one task per frame, which keeps each pool externally synchronised whichever worker runs it.
+		frame.secondaryCommandPools.resize(m_recordingThreadPool.GetThreadCount(), VK_NULL_HANDLE);
+		frame.secondaryCommandBuffers.resize(m_recordingThreadPool.GetThreadCount(), VK_NULL_HANDLE);
+		frame.secondaryRecordedFlags.resize(m_recordingThreadPool.GetThreadCount(), 0u);
+		frame.recordedSecondaryStatistics.resize(m_recordingThreadPool.GetThreadCount());
+
+		for (std::size_t i = 0; i < frame.secondaryCommandPools.size(); ++i)
+		{
+			if (vkCreateCommandPool(m_vulkanContext.GetLogicalDevice(), &secondaryCommandPoolCreateInfo, nullptr, &frame.secondaryCommandPools[i]) != VK_SUCCESS)
+			{
+				throw std::runtime_error("Failed to create Vulkan secondary command pool.");
+			}
+
+			commandBufferAllocateInfo.commandPool = frame.secondaryCommandPools[i];
+			commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+
+			if (vkAllocateCommandBuffers(m_vulkanContext.GetLogicalDevice(), &commandBufferAllocateInfo, &frame.secondaryCommandBuffers[i]) != VK_SUCCESS)
+			{
+				throw std::runtime_error("Failed to allocate Vulkan secondary command buffers.");
+			}
+		}
+
+		const std::array<std::reference_wrapper<VkSemaphore>, 2u> semaphores{ std::ref(frame.imageAvailableSemaphore), std::ref(frame.renderFinishedSemaphore) };
 
 		for (auto& semaphore : semaphores)
 		{
@@ -238,38 +695,78 @@ void Renderer::InitialiseSynchronisationPrimitives()
 			}
 		}
 
-		if (vkCreateFence(m_vulkanContext.GetLogicalDevice(), &fenceCreateInfo, nullptr, &inFlightFence) != VK_SUCCESS)
+		if (vkCreateFence(m_vulkanContext.GetLogicalDevice(), &fenceCreateInfo, nullptr, &frame.inFlightFence) != VK_SUCCESS)
 		{
 			throw std::runtime_error("Failed to create Vulkan fence.");
 		}
 	}
 }
 
-void Renderer::DestroySynchronisationPrimitives() noexcept
+void Renderer::DestroyFrameResources() noexcept
 {
-	if (!m_perFrameSynchronisation.empty())
+	for (auto& frame : m_frameResources)
 	{
-		for (auto& [imageAvailableSemaphore, renderFinishedSemaphore, inFlightFence] : m_perFrameSynchronisation)
-		{
-			const std::array<std::reference_wrapper<VkSemaphore>, 2u> semaphores{ std::ref(imageAvailableSemaphore), std::ref(renderFinishedSemaphore) };
+		FlushDeletionQueue(frame);
 
-			for (auto& semaphore : semaphores)
+		const std::array<std::reference_wrapper<VkSemaphore>, 2u> semaphores{ std::ref(frame.imageAvailableSemaphore), std::ref(frame.renderFinishedSemaphore) };
+
+		for (auto& semaphore : semaphores)
+		{
+			if (semaphore.get() != VK_NULL_HANDLE)
 			{
 				vkDestroySemaphore(m_vulkanContext.GetLogicalDevice(), semaphore, nullptr);
 				semaphore.get() = VK_NULL_HANDLE;
 			}
+		}
 
-			vkDestroyFence(m_vulkanContext.GetLogicalDevice(), inFlightFence, nullptr);
-			inFlightFence = VK_NULL_HANDLE;
+		if (frame.inFlightFence != VK_NULL_HANDLE)
+		{
+			vkDestroyFence(m_vulkanContext.GetLogicalDevice(), frame.inFlightFence, nullptr);
+			frame.inFlightFence = VK_NULL_HANDLE;
+		}
+
+		for (auto& secondaryCommandPool : frame.secondaryCommandPools)
+		{
+			if (secondaryCommandPool != VK_NULL_HANDLE)
+			{
+				vkDestroyCommandPool(m_vulkanContext.GetLogicalDevice(), secondaryCommandPool, nullptr);
+			}
 		}
 
-		m_perFrameSynchronisation.clear();
+		frame.secondaryCommandPools.clear();
+		frame.secondaryCommandBuffers.clear();
+		frame.secondaryRecordedFlags.clear();
+		frame.recordedSecondaryStatistics.clear();
+		frame.recordedSecondaryTaskCount = 0;
+
+		if (frame.commandPool != VK_NULL_HANDLE)
+		{
+			vkDestroyCommandPool(m_vulkanContext.GetLogicalDevice(), frame.commandPool, nullptr);
+			frame.commandPool = VK_NULL_HANDLE;
+			frame.commandBuffer = VK_NULL_HANDLE;
+		}
 	}
 }
 
+void Renderer::FlushDeletionQueue(FrameResources& frame) noexcept
+{
+	for (auto& deleter : frame.deletionQueue)
+	{
+		deleter();
+	}
+
+	frame.deletionQueue.clear();
+}
 
 void Renderer::InitialiseSwapchain()
 {
+	if (IsHeadless())
+	{
+		InitialiseOffscreenImages();
+
+		return;
+	}
+
 	const VulkanContext::SurfaceProperties surfaceProperties = m_vulkanContext.GetSurfaceProperties(m_vulkanContext.GetPhysicalDevice());
 
 	m_surfaceFormat = GetBestSurfaceFormat(surfaceProperties.surfaceFormats);
@@ -390,7 +887,7 @@ void Renderer::InitialiseSwapchainImages()
 	}
 	else
 	{
-		const glm::uvec2 drawableWindowSize = m_window.GetDrawableSize();
+		const glm::uvec2 drawableWindowSize = m_window->GetDrawableSize();
 
 		VkExtent2D actualSurfaceExtent{ drawableWindowSize.x, drawableWindowSize.y };
 		actualSurfaceExtent.width = std::clamp(actualSurfaceExtent.width, surfaceCapabilities.minImageExtent.width, surfaceCapabilities.maxImageExtent.width);
@@ -416,6 +913,13 @@ void Renderer::DestroySwapchainImages() noexcept
 
 void Renderer::DestroySwapchain() noexcept
 {
+	if (IsHeadless())
+	{
+		DestroyOffscreenImages();
+
+		return;
+	}
+
 	DestroySwapchainImages();
 	
 	if (m_swapchain != VK_NULL_HANDLE)
@@ -427,28 +931,62 @@ void Renderer::DestroySwapchain() noexcept
 	}
 }
 
-void Renderer::AllocateCommandBuffers()
+void Renderer::InitialiseOffscreenImages()
+{
+	m_surfaceFormat = VkSurfaceFormatKHR{ s_HeadlessColourFormat, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR };
+
+	m_offscreenImages.resize(s_MaxFramesInFlight);
+	m_swapchainImages.resize(s_MaxFramesInFlight, VK_NULL_HANDLE);
+	m_swapchainImageViews.resize(s_MaxFramesInFlight, VK_NULL_HANDLE);
+
+	for (std::size_t i = 0; i < m_offscreenImages.size(); ++i)
+	{
+		vulkan_util::CreateImage(m_vulkanContext, m_swapchainExtent.width, m_swapchainExtent.height, s_HeadlessColourFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT, VMA_MEMORY_USAGE_GPU_ONLY, MemoryTracker::Category::ColourTargets, m_offscreenImages[i].image, m_offscreenImages[i].allocation);
+
+		m_swapchainImages[i] = m_offscreenImages[i].image;
+		m_swapchainImageViews[i] = vulkan_util::CreateImageView(m_vulkanContext, m_swapchainImages[i], s_HeadlessColourFormat, VK_IMAGE_ASPECT_COLOR_BIT);
+	}
+}
+
+void Renderer::DestroyOffscreenImages() noexcept
 {
-	m_commandBuffers.resize(m_swapchainImages.size());
+	for (auto& swapchainImageView : m_swapchainImageViews)
+	{
+		if (swapchainImageView != VK_NULL_HANDLE)
+		{
+			vkDestroyImageView(m_vulkanContext.GetLogicalDevice(), swapchainImageView, nullptr);
+		}
+	}
 
-	VkCommandBufferAllocateInfo commandBufferAllocateInfo{ };
-	commandBufferAllocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-	commandBufferAllocateInfo.commandPool = m_vulkanContext.GetCommandPool();
-	commandBufferAllocateInfo.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-	commandBufferAllocateInfo.commandBufferCount = static_cast<std::uint32_t>(m_commandBuffers.size());
+	m_swapchainImageViews.clear();
 
-	if (vkAllocateCommandBuffers(m_vulkanContext.GetLogicalDevice(), &commandBufferAllocateInfo, m_commandBuffers.data()) != VK_SUCCESS)
+	for (auto& offscreenImage : m_offscreenImages)
 	{
-		throw std::runtime_error("Failed to allocate Vulkan command buffers.");
+		vulkan_util::DestroyImage(m_vulkanContext, offscreenImage.image, offscreenImage.allocation);
 	}
+
+	m_offscreenImages.clear();
+	m_swapchainImages.clear();
 }
 
-void Renderer::DeallocateCommandBuffers() noexcept
+void Renderer::BeginSecondaryCommandBuffer(const VkCommandBuffer commandBuffer) const
 {
-	if (!m_commandBuffers.empty())
+	VkCommandBufferInheritanceInfo commandBufferInheritanceInfo{ };
+	commandBufferInheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+	commandBufferInheritanceInfo.renderPass = m_renderPass;
+	commandBufferInheritanceInfo.subpass = 0;
+	commandBufferInheritanceInfo.framebuffer = VK_NULL_HANDLE;
+	commandBufferInheritanceInfo.occlusionQueryEnable = VK_FALSE;
+	commandBufferInheritanceInfo.pipelineStatistics = m_gpuProfiler.SupportsPipelineStatistics() ? GPUProfiler::GetPipelineStatisticFlags() : 0;
+
+	VkCommandBufferBeginInfo commandBufferBeginInfo{ };
+	commandBufferBeginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+	commandBufferBeginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+	commandBufferBeginInfo.pInheritanceInfo = &commandBufferInheritanceInfo;
+
+	if (vkBeginCommandBuffer(commandBuffer, &commandBufferBeginInfo) != VK_SUCCESS)
 	{
-		vkFreeCommandBuffers(m_vulkanContext.GetLogicalDevice(), m_vulkanContext.GetCommandPool(), static_cast<std::uint32_t>(m_commandBuffers.size()), m_commandBuffers.data());
-		m_commandBuffers.clear();
+		throw std::runtime_error("Failed to begin recording Vulkan secondary command buffer.");
 	}
 }
 
@@ -470,7 +1008,7 @@ void Renderer::InitialiseRenderPass()
 		attachmentDescriptions[AttachmentType::Colour].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
 		attachmentDescriptions[AttachmentType::Colour].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
 		attachmentDescriptions[AttachmentType::Colour].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-		attachmentDescriptions[AttachmentType::Colour].finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
+		attachmentDescriptions[AttachmentType::Colour].finalLayout = IsHeadless() ? VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL : VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
 
 		attachmentDescriptions[AttachmentType::DepthStencil].format = FindDepthStencilFormat();
 		attachmentDescriptions[AttachmentType::DepthStencil].samples = VK_SAMPLE_COUNT_1_BIT;
@@ -515,9 +1053,9 @@ void Renderer::InitialiseRenderPass()
 		subpassDependencies[1].srcSubpass = 0;
 		subpassDependencies[1].dstSubpass = VK_SUBPASS_EXTERNAL;
 		subpassDependencies[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-		subpassDependencies[1].dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
+		subpassDependencies[1].dstStageMask = IsHeadless() ? VK_PIPELINE_STAGE_TRANSFER_BIT : VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT;
 		subpassDependencies[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-		subpassDependencies[1].dstAccessMask = VK_ACCESS_MEMORY_READ_BIT;
+		subpassDependencies[1].dstAccessMask = IsHeadless() ? VK_ACCESS_TRANSFER_READ_BIT : VK_ACCESS_MEMORY_READ_BIT;
 		subpassDependencies[1].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
 	}
 	
@@ -591,7 +1129,7 @@ void Renderer::InitialiseDepthStencilBuffer()
 {
 	const VkFormat depthStencilFormat = FindDepthStencilFormat();
 	
-	vulkan_util::CreateImage(m_vulkanContext, m_swapchainExtent.width, m_swapchainExtent.height, depthStencilFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VMA_MEMORY_USAGE_GPU_ONLY, m_depthStencilBuffer.image, m_depthStencilBuffer.allocation);
+	vulkan_util::CreateImage(m_vulkanContext, m_swapchainExtent.width, m_swapchainExtent.height, depthStencilFormat, VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VMA_MEMORY_USAGE_GPU_ONLY, MemoryTracker::Category::DepthBuffers, m_depthStencilBuffer.image, m_depthStencilBuffer.allocation);
 	m_depthStencilBuffer.imageView = vulkan_util::CreateImageView(m_vulkanContext, m_depthStencilBuffer.image, depthStencilFormat, VK_IMAGE_ASPECT_DEPTH_BIT);
 
 	vulkan_util::TransitionImageLayout(m_vulkanContext, m_depthStencilBuffer.image, depthStencilFormat, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, m_supportsStencil);
@@ -624,9 +1162,7 @@ void Renderer::DestroyDepthStencilBuffer() noexcept
 		vkDestroyImageView(m_vulkanContext.GetLogicalDevice(), m_depthStencilBuffer.imageView, nullptr);
 		m_depthStencilBuffer.imageView = VK_NULL_HANDLE;
 
-		vmaDestroyImage(m_vulkanContext.GetAllocator(), m_depthStencilBuffer.image, m_depthStencilBuffer.allocation);
-		m_depthStencilBuffer.image = VK_NULL_HANDLE;
-		m_depthStencilBuffer.allocation = VK_NULL_HANDLE;
+		vulkan_util::DestroyImage(m_vulkanContext, m_depthStencilBuffer.image, m_depthStencilBuffer.allocation);
 	}
 }
 
@@ -634,7 +1170,6 @@ void Renderer::CleanupPresentationObjects() noexcept
 {
 	FinaliseRenderOperations();
 
-	DeallocateCommandBuffers();
 	DestroyFramebuffers();
 	DestroyDepthStencilBuffer();
 	DestroyRenderPass();
@@ -646,13 +1181,13 @@ void Renderer::RecreatePresentationObjects()
 	VkSurfaceCapabilitiesKHR surfaceCapabilities{ };
 	vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_vulkanContext.GetPhysicalDevice(), m_vulkanContext.GetSurface(), &surfaceCapabilities);
 
-	glm::uvec2 drawableWindowSize = m_window.GetDrawableSize();
+	glm::uvec2 drawableWindowSize = m_window->GetDrawableSize();
 
-	while (m_window.IsMinimised() || surfaceCapabilities.currentExtent.width == 0 || surfaceCapabilities.currentExtent.height == 0 ||
+	while (m_window->IsMinimised() || surfaceCapabilities.currentExtent.width == 0 || surfaceCapabilities.currentExtent.height == 0 ||
 		   (surfaceCapabilities.currentExtent.width == std::numeric_limits<std::uint32_t>::max() && drawableWindowSize.x == 0) ||
 		   (surfaceCapabilities.currentExtent.height == std::numeric_limits<std::uint32_t>::max() && drawableWindowSize.y == 0))
 	{
-		drawableWindowSize = m_window.GetDrawableSize();
+		drawableWindowSize = m_window->GetDrawableSize();
 		vkGetPhysicalDeviceSurfaceCapabilitiesKHR(m_vulkanContext.GetPhysicalDevice(), m_vulkanContext.GetSurface(), &surfaceCapabilities);
 
 		SDL_WaitEvent(nullptr);
@@ -664,5 +1199,6 @@ void Renderer::RecreatePresentationObjects()
 	InitialiseRenderPass();
 	InitialiseDepthStencilBuffer();
 	InitialiseFramebuffers();
-	AllocateCommandBuffers();
+
+	InvalidateSecondaryCommandBuffers();
 }
\ No newline at end of file
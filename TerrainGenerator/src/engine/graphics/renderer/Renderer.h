@@ -3,30 +3,47 @@
 #include "../../utility/interfaces/INoncopyable.h"
 #include "../../utility/interfaces/INonmovable.h"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <string>
 #include <vector>
 
 #include <glm/glm.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <vulkan/vulkan.h>
 
+#include "../../utility/ThreadPool.h"
 #include "../../window/Window.h"
 #include "../buffers/IndexBuffer.h"
+#include "../buffers/IndirectBuffer.h"
 #include "../buffers/VertexBuffer.h"
 #include "../pipeline/GraphicsPipeline.h"
+#include "FrameStatistics.h"
+#include "GPUProfiler.h"
 #include "VulkanContext.h"
 
 class Renderer
 	: private INoncopyable, private INonmovable
 {
 private:
-	struct FrameSynchronisationPrimitives
+	struct FrameResources
 	{
+		VkCommandPool commandPool = VK_NULL_HANDLE;
+		VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+
+		std::vector<VkCommandPool> secondaryCommandPools;
+		std::vector<VkCommandBuffer> secondaryCommandBuffers;
+		std::vector<std::uint8_t> secondaryRecordedFlags;
+		std::vector<FrameStatistics::Values> recordedSecondaryStatistics;
+		std::uint32_t recordedSecondaryTaskCount = 0;
+
 		VkSemaphore imageAvailableSemaphore = VK_NULL_HANDLE;
 		VkSemaphore renderFinishedSemaphore = VK_NULL_HANDLE;
-
 		VkFence inFlightFence = VK_NULL_HANDLE;
+
+		mutable std::vector<std::function<void()>> deletionQueue;
 	};
 
 	struct DepthStencilBuffer
@@ -37,16 +54,35 @@ private:
 		VmaAllocation allocation = VK_NULL_HANDLE;
 	};
 
+	struct OffscreenImage
+	{
+		VkImage image = VK_NULL_HANDLE;
+		VmaAllocation allocation = VK_NULL_HANDLE;
+	};
+
 	static constexpr std::size_t s_MaxFramesInFlight = 2u;
+	static constexpr VkFormat s_HeadlessColourFormat = VK_FORMAT_R8G8B8A8_SRGB;
+	static constexpr const char* s_PipelineCacheFilepath = "pipeline_cache.bin";
+
+	inline static thread_local VkCommandBuffer s_currentSecondaryCommandBuffer = VK_NULL_HANDLE;
+	inline static thread_local FrameStatistics::Values* s_currentSecondaryStatistics = nullptr;
 	
-	const Window& m_window;
+	const Window* m_window = nullptr;
 	VulkanContext m_vulkanContext;
 
-	std::vector<VkCommandBuffer> m_commandBuffers{ };
-	std::uint32_t m_nextAcquiredImageIndex = 0;
+	ThreadPool m_recordingThreadPool;
+	GPUProfiler m_gpuProfiler;
+	mutable FrameStatistics m_frameStatistics;
+
+	std::array<FrameResources, s_MaxFramesInFlight> m_frameResources{ };
+	std::uint32_t m_currentFrameIndex = 0;
+	std::uint32_t m_lastSubmittedFrameIndex = static_cast<std::uint32_t>(s_MaxFramesInFlight - 1);
+	bool m_hasSubmittedFrame = false;
+	std::uint32_t m_allocatorFrameIndex = 0;
+
+	std::vector<std::function<void(VkCommandBuffer)>> m_deferredTransferCommands;
 
-	std::vector<FrameSynchronisationPrimitives> m_perFrameSynchronisation;
-	std::size_t m_currentFrameInFlight = 0;
+	std::uint32_t m_nextAcquiredImageIndex = 0;
 
 	VkSurfaceFormatKHR m_surfaceFormat{ };
 	VkPresentModeKHR m_presentationMode = VK_PRESENT_MODE_FIFO_KHR;
@@ -55,8 +91,11 @@ private:
 	VkSwapchainKHR m_swapchain = VK_NULL_HANDLE;
 	std::vector<VkImage> m_swapchainImages;
 	std::vector<VkImageView> m_swapchainImageViews;
+	std::vector<OffscreenImage> m_offscreenImages;
 
 	VkPipelineCache m_pipelineCache = VK_NULL_HANDLE;
+	bool m_hasWarmPipelineCache = false;
+
 	VkRenderPass m_renderPass = VK_NULL_HANDLE;
 	std::vector<VkFramebuffer> m_framebuffers;
 
@@ -67,14 +106,29 @@ private:
 
 public:
 	Renderer(const Window& window);
+	Renderer(const VkExtent2D& headlessExtent);
 	~Renderer() noexcept;
 
 	bool PrepareRender();
-	void BeginRender(const glm::vec4& clearColour = glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f });
+	void BeginRender(const glm::vec4& clearColour = glm::vec4{ 0.0f, 0.0f, 0.0f, 1.0f }, const VkSubpassContents subpassContents = VK_SUBPASS_CONTENTS_INLINE);
 	void EndRender();
 	void Present();
 	void FinaliseRenderOperations() const noexcept;
 
+	void CaptureFrame(const std::string& ppmFilepath) const;
+
+	void ExecuteSecondaryCommandBuffers(const std::uint32_t taskCount, const std::function<bool(std::uint32_t)>& updateFunction, const std::function<void(std::uint32_t)>& recordFunction);
+	void InvalidateSecondaryCommandBuffers() noexcept;
+	void WaitForFramesInFlight() const;
+
+	void DeferDeletion(std::function<void()> deleter) const;
+	void DeferTransferCommands(std::function<void(VkCommandBuffer)> recordFunction);
+
+	void RecordStatistic(const FrameStatistics::Statistic statistic, const std::uint64_t amount = 1u) const noexcept;
+
+	void BeginGPUZone(const char* name);
+	void EndGPUZone();
+
 	void BindPipeline(const GraphicsPipeline& pipeline);
 
 	void BindVertexBuffer(const VertexBuffer& vertexBuffer);
@@ -83,19 +137,30 @@ public:
 	template <typename T>
 	void PushConstants(const GraphicsPipeline& pipeline, const T& data)
 	{
-		vkCmdPushConstants(m_commandBuffers[m_nextAcquiredImageIndex], pipeline.GetLayout(), pipeline.GetPushConstantStageFlags(), 0, sizeof(T), &data);
+		vkCmdPushConstants(GetCurrentCommandBuffer(), pipeline.GetLayout(), pipeline.GetPushConstantStageFlags(), 0, sizeof(T), &data);
+		RecordStatistic(FrameStatistics::Statistic::PushConstantBytes, sizeof(T));
 	}
 
-	void BindDescriptorSet(const GraphicsPipeline& pipeline);
+	void BindDescriptorSet(const GraphicsPipeline& pipeline, const std::uint32_t uniformBlockIndex = 0);
 
 	void Draw(const std::uint32_t vertexCount);
 	void DrawIndexed(const std::uint32_t indexCount);
+	void DrawIndexedIndirect(const IndirectBuffer& indirectBuffer, const std::uint32_t regionIndex);
 
 	void ProcessWindowResize();
 
 	inline const VulkanContext& GetVulkanContext() const noexcept { return m_vulkanContext; }
+	inline const GPUProfiler& GetGPUProfiler() const noexcept { return m_gpuProfiler; }
+	inline FrameStatistics& GetFrameStatistics() const noexcept { return m_frameStatistics; }
+	inline bool IsHeadless() const noexcept { return m_vulkanContext.IsHeadless(); }
 
+	static constexpr std::uint32_t GetMaxFramesInFlight() noexcept { return static_cast<std::uint32_t>(s_MaxFramesInFlight); }
+	inline std::uint32_t GetCurrentFrameIndex() const noexcept { return m_currentFrameIndex; }
 	inline std::uint32_t GetNextAcquiredImageIndex() const noexcept { return m_nextAcquiredImageIndex; }
+	inline std::uint32_t GetSecondaryCommandBufferCount() const noexcept { return static_cast<std::uint32_t>(m_recordingThreadPool.GetThreadCount()); }
+
+	inline VkPipelineCache GetPipelineCache() const noexcept { return m_pipelineCache; }
+	inline bool HasWarmPipelineCache() const noexcept { return m_hasWarmPipelineCache; }
 
 	inline const VkExtent2D& GetSwapchainExtent() const noexcept { return m_swapchainExtent; }
 	inline std::uint32_t GetSwapchainImageCount() const noexcept { return static_cast<std::uint32_t>(m_swapchainImages.size()); }
@@ -104,11 +169,22 @@ public:
 	inline bool SupportsStencilOperations() const noexcept { return m_supportsStencil; }
 
 private:
+	inline VkCommandBuffer GetCurrentCommandBuffer() const noexcept
+	{
+		return s_currentSecondaryCommandBuffer != VK_NULL_HANDLE ? s_currentSecondaryCommandBuffer : m_frameResources[m_currentFrameIndex].commandBuffer;
+	}
+
+	void Initialise();
+
 	void InitialisePipelineCache();
+	[[nodiscard]] std::vector<std::byte> LoadPipelineCacheData() const;
+	[[nodiscard]] bool IsPipelineCacheDataValid(const std::vector<std::byte>& pipelineCacheData) const;
+	void SavePipelineCache() const noexcept;
 	void DestroyPipelineCache() noexcept;
 
-	void InitialiseSynchronisationPrimitives();
-	void DestroySynchronisationPrimitives() noexcept;
+	void InitialiseFrameResources();
+	void DestroyFrameResources() noexcept;
+	void FlushDeletionQueue(FrameResources& frame) noexcept;
 
 	void InitialiseSwapchain();
 	void InitialiseSwapchainImages();
@@ -118,8 +194,10 @@ private:
 	void DestroySwapchainImages() noexcept;
 	void DestroySwapchain() noexcept;
 
-	void AllocateCommandBuffers();
-	void DeallocateCommandBuffers() noexcept;
+	void InitialiseOffscreenImages();
+	void DestroyOffscreenImages() noexcept;
+
+	void BeginSecondaryCommandBuffer(const VkCommandBuffer commandBuffer) const;
 
 	void InitialiseRenderPass();
 	void DestroyRenderPass() noexcept;
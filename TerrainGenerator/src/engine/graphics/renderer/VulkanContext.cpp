@@ -1,7 +1,11 @@
 #include "VulkanContext.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstring>
+#include <fstream>
 #include <functional>
+#include <iomanip>
 #include <iterator>
 #include <limits>
 #include <map>
@@ -14,7 +18,15 @@
 
 #include "VulkanValidationLayers.h"
 
+VulkanContext::VulkanContext()
+	: VulkanContext(nullptr)
+{ }
+
 VulkanContext::VulkanContext(const Window& window)
+	: VulkanContext(&window)
+{ }
+
+VulkanContext::VulkanContext(const Window* const window)
 	: m_window(window)
 {
 	InitialiseInstance();
@@ -88,6 +100,53 @@ void VulkanContext::WaitOnPresentationQueue() const
 	vkQueueWaitIdle(m_presentationQueue);
 }
 
+[[nodiscard]] std::vector<VmaBudget> VulkanContext::GetMemoryBudgets() const
+{
+	std::vector<VmaBudget> memoryBudgets(VK_MAX_MEMORY_HEAPS);
+	vmaGetBudget(m_allocator, memoryBudgets.data());
+	memoryBudgets.resize(m_physicalDeviceMemoryProperties.memoryHeapCount);
+
+	return memoryBudgets;
+}
+
+void VulkanContext::PrintMemoryBudgets(std::ostream& outputStream) const
+{
+	constexpr double BytesPerMebibyte = 1'024.0 * 1'024.0;
+
+	const std::vector<VmaBudget> memoryBudgets = GetMemoryBudgets();
+
+	outputStream << "Memory budgets (" << (m_supportsMemoryBudget ? "VK_EXT_memory_budget" : "estimated") << "):\n";
+	outputStream << std::fixed << std::setprecision(2);
+
+	for (std::size_t i = 0; i < memoryBudgets.size(); ++i)
+	{
+		const bool isDeviceLocal = m_physicalDeviceMemoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+
+		outputStream << "  Heap " << i << (isDeviceLocal ? " (device local)" : " (host)") << ": "
+			<< static_cast<double>(memoryBudgets[i].usage) / BytesPerMebibyte << " / " << static_cast<double>(memoryBudgets[i].budget) / BytesPerMebibyte << " MiB used, "
+			<< static_cast<double>(memoryBudgets[i].allocationBytes) / BytesPerMebibyte << " MiB in allocations, "
+			<< static_cast<double>(memoryBudgets[i].blockBytes) / BytesPerMebibyte << " MiB in blocks\n";
+	}
+
+	outputStream << std::defaultfloat;
+}
+
+void VulkanContext::WriteAllocatorStatistics(const std::string& filepath) const
+{
+	char* statisticsString = nullptr;
+	vmaBuildStatsString(m_allocator, &statisticsString, VK_TRUE);
+
+	std::ofstream statisticsFile(filepath, std::ios_base::out | std::ios_base::trunc);
+	statisticsFile << statisticsString;
+
+	vmaFreeStatsString(m_allocator, statisticsString);
+
+	if (!statisticsFile)
+	{
+		throw std::runtime_error("Failed to write allocator statistics file " + filepath + ".");
+	}
+}
+
 bool VulkanContext::AreQueueFamilyIndicesComplete(const QueueFamilyIndices& queueFamilyIndices)
 {
 	return queueFamilyIndices.graphicsFamilyIndex.has_value() && queueFamilyIndices.presentationFamilyIndex.has_value();
@@ -115,7 +174,14 @@ void VulkanContext::InitialiseInstance()
 	instanceCreateInfo.sType = VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO;
 	instanceCreateInfo.pApplicationInfo = &applicationInfo;
 
-	const auto requiredInstanceExtensions = GetRequiredInstanceExtensions();
+	auto requiredInstanceExtensions = GetRequiredInstanceExtensions();
+
+	if (SupportsInstanceExtension(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME))
+	{
+		requiredInstanceExtensions.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
+		m_hasPhysicalDeviceProperties2 = true;
+	}
+
 	instanceCreateInfo.enabledExtensionCount = static_cast<std::uint32_t>(requiredInstanceExtensions.size());
 	instanceCreateInfo.ppEnabledExtensionNames = requiredInstanceExtensions.data();
 
@@ -144,22 +210,27 @@ void VulkanContext::InitialiseInstance()
 
 std::vector<const char*> VulkanContext::GetRequiredInstanceExtensions() const
 {
-	std::uint32_t requiredSDLInstanceExtensionCount = 0;
+	std::vector<const char*> requiredInstanceExtensions;
 
-	if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &requiredSDLInstanceExtensionCount, nullptr))
+	if (!IsHeadless())
 	{
-		using namespace std::literals::string_literals;
+		std::uint32_t requiredSDLInstanceExtensionCount = 0;
 
-		throw std::runtime_error("Failed to get required SDL Vulkan instance extensions count: "s + SDL_GetError());
-	}
+		if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &requiredSDLInstanceExtensionCount, nullptr))
+		{
+			using namespace std::literals::string_literals;
 
-	std::vector<const char*> requiredInstanceExtensions(requiredSDLInstanceExtensionCount);
+			throw std::runtime_error("Failed to get required SDL Vulkan instance extensions count: "s + SDL_GetError());
+		}
 
-	if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &requiredSDLInstanceExtensionCount, requiredInstanceExtensions.data()))
-	{
-		using namespace std::literals::string_literals;
+		requiredInstanceExtensions.resize(requiredSDLInstanceExtensionCount);
+
+		if (!SDL_Vulkan_GetInstanceExtensions(nullptr, &requiredSDLInstanceExtensionCount, requiredInstanceExtensions.data()))
+		{
+			using namespace std::literals::string_literals;
 
-		throw std::runtime_error("Failed to get required SDL Vulkan instance extensions' names: "s + SDL_GetError());
+			throw std::runtime_error("Failed to get required SDL Vulkan instance extensions' names: "s + SDL_GetError());
+		}
 	}
 
 	if constexpr (VulkanValidationLayers::AreEnabled())
@@ -198,6 +269,20 @@ std::vector<const char*> VulkanContext::GetRequiredInstanceExtensions() const
 	return requiredInstanceExtensions;
 }
 
+[[nodiscard]] bool VulkanContext::SupportsInstanceExtension(const char* const instanceExtensionName) const
+{
+	std::uint32_t availableInstanceExtensionCount = 0;
+	vkEnumerateInstanceExtensionProperties(nullptr, &availableInstanceExtensionCount, nullptr);
+
+	std::vector<VkExtensionProperties> availableInstanceExtensions(availableInstanceExtensionCount);
+	vkEnumerateInstanceExtensionProperties(nullptr, &availableInstanceExtensionCount, availableInstanceExtensions.data());
+
+	return std::ranges::any_of(availableInstanceExtensions, [instanceExtensionName](const VkExtensionProperties& extensionProperties)
+	{
+		return std::strcmp(instanceExtensionName, extensionProperties.extensionName) == 0;
+	});
+}
+
 void VulkanContext::DestroyInstance() noexcept
 {
 	if (m_instance != VK_NULL_HANDLE)
@@ -210,7 +295,10 @@ void VulkanContext::DestroyInstance() noexcept
 
 void VulkanContext::InitialiseSurface()
 {
-	m_surface = m_window.CreateVulkanSurface(m_instance);
+	if (!IsHeadless())
+	{
+		m_surface = m_window->CreateVulkanSurface(m_instance);
+	}
 }
 
 void VulkanContext::DestroySurface() noexcept
@@ -279,11 +367,11 @@ void VulkanContext::SelectPhysicalDevice()
 	}
 
 	const QueueFamilyIndices queueFamilyIndices = FindQueueFamilyIndices(physicalDevice);
-	const bool supportsRequiredDeviceExtensions = SupportsRequiredDeviceExtensions(physicalDevice);
+	const bool supportsRequiredDeviceExtensions = IsHeadless() || SupportsDeviceExtensions(physicalDevice, s_RequiredDeviceExtensions);
 
-	bool isSurfaceFullySupported = false;
+	bool isSurfaceFullySupported = IsHeadless();
 
-	if (supportsRequiredDeviceExtensions)
+	if (!IsHeadless() && supportsRequiredDeviceExtensions)
 	{
 		const auto surfaceProperties = GetSurfaceProperties(physicalDevice);
 		isSurfaceFullySupported = !surfaceProperties.surfaceFormats.empty() && !surfaceProperties.presentationModes.empty();
@@ -371,12 +459,19 @@ void VulkanContext::SelectPhysicalDevice()
 			queueFamilyIndices.graphicsFamilyIndex = currentIndex;
 		}
 
-		VkBool32 supportsPresentation = VK_FALSE;
-		vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, currentIndex, m_surface, &supportsPresentation);
-
-		if (supportsPresentation)
+		if (IsHeadless())
 		{
-			queueFamilyIndices.presentationFamilyIndex = currentIndex;
+			queueFamilyIndices.presentationFamilyIndex = queueFamilyIndices.graphicsFamilyIndex;
+		}
+		else
+		{
+			VkBool32 supportsPresentation = VK_FALSE;
+			vkGetPhysicalDeviceSurfaceSupportKHR(physicalDevice, currentIndex, m_surface, &supportsPresentation);
+
+			if (supportsPresentation)
+			{
+				queueFamilyIndices.presentationFamilyIndex = currentIndex;
+			}
 		}
 
 		if (AreQueueFamilyIndicesComplete(queueFamilyIndices))
@@ -390,7 +485,7 @@ void VulkanContext::SelectPhysicalDevice()
 	return queueFamilyIndices;
 }
 
-bool VulkanContext::SupportsRequiredDeviceExtensions(const VkPhysicalDevice physicalDevice) const
+bool VulkanContext::SupportsDeviceExtensions(const VkPhysicalDevice physicalDevice, const std::span<const char* const> deviceExtensions) const
 {
 	std::uint32_t availableDeviceExtensionCount = 0;
 	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableDeviceExtensionCount, nullptr);
@@ -398,7 +493,7 @@ bool VulkanContext::SupportsRequiredDeviceExtensions(const VkPhysicalDevice phys
 	std::vector<VkExtensionProperties> availableDeviceExtensions(availableDeviceExtensionCount);
 	vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &availableDeviceExtensionCount, availableDeviceExtensions.data());
 
-	std::unordered_set<std::string> requiredDeviceExtensions(std::cbegin(s_RequiredDeviceExtensions), std::cend(s_RequiredDeviceExtensions));
+	std::unordered_set<std::string> requiredDeviceExtensions(std::cbegin(deviceExtensions), std::cend(deviceExtensions));
 
 	for (const auto& availableDeviceExtension : availableDeviceExtensions)
 	{
@@ -413,6 +508,61 @@ bool VulkanContext::SupportsRequiredDeviceExtensions(const VkPhysicalDevice phys
 	return false;
 }
 
+[[nodiscard]] bool VulkanContext::QueryDescriptorIndexingSupport(const VkPhysicalDevice physicalDevice, DescriptorIndexingLimits& descriptorIndexingLimits) const
+{
+	if (!m_hasPhysicalDeviceProperties2 || !SupportsDeviceExtensions(physicalDevice, s_DescriptorIndexingDeviceExtensions))
+	{
+		return false;
+	}
+
+	const auto getPhysicalDeviceFeatures2 = reinterpret_cast<PFN_vkGetPhysicalDeviceFeatures2KHR>(vkGetInstanceProcAddr(m_instance, "vkGetPhysicalDeviceFeatures2KHR"));
+	const auto getPhysicalDeviceProperties2 = reinterpret_cast<PFN_vkGetPhysicalDeviceProperties2KHR>(vkGetInstanceProcAddr(m_instance, "vkGetPhysicalDeviceProperties2KHR"));
+
+	if (getPhysicalDeviceFeatures2 == nullptr || getPhysicalDeviceProperties2 == nullptr)
+	{
+		return false;
+	}
+
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures{ };
+	descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+	VkPhysicalDeviceFeatures2KHR physicalDeviceFeatures{ };
+	physicalDeviceFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2_KHR;
+	physicalDeviceFeatures.pNext = &descriptorIndexingFeatures;
+	getPhysicalDeviceFeatures2(physicalDevice, &physicalDeviceFeatures);
+
+	const std::vector<VkBool32> requiredDescriptorIndexingFeatures{
+		descriptorIndexingFeatures.runtimeDescriptorArray,
+		descriptorIndexingFeatures.descriptorBindingPartiallyBound,
+		descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending,
+		descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind,
+		descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind,
+		descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing,
+		descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing
+	};
+
+	for (const auto requiredDescriptorIndexingFeature : requiredDescriptorIndexingFeatures)
+	{
+		if (!requiredDescriptorIndexingFeature)
+		{
+			return false;
+		}
+	}
+
+	VkPhysicalDeviceDescriptorIndexingPropertiesEXT descriptorIndexingProperties{ };
+	descriptorIndexingProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES_EXT;
+
+	VkPhysicalDeviceProperties2KHR physicalDeviceProperties{ };
+	physicalDeviceProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2_KHR;
+	physicalDeviceProperties.pNext = &descriptorIndexingProperties;
+	getPhysicalDeviceProperties2(physicalDevice, &physicalDeviceProperties);
+
+	descriptorIndexingLimits.maxStorageBuffers = std::min(descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers, descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers);
+	descriptorIndexingLimits.maxSampledImages = std::min(descriptorIndexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages, descriptorIndexingProperties.maxDescriptorSetUpdateAfterBindSampledImages);
+
+	return true;
+}
+
 void VulkanContext::InitialiseDevice()
 {
 	SelectPhysicalDevice();
@@ -433,6 +583,23 @@ void VulkanContext::InitialiseDevice()
 		deviceQueueCreateInfos.push_back(deviceQueueCreateInfo);
 	}
 
+	VkPhysicalDeviceFeatures supportedPhysicalDeviceFeatures{ };
+	vkGetPhysicalDeviceFeatures(m_physicalDevice, &supportedPhysicalDeviceFeatures);
+	m_supportsMultiDrawIndirect = supportedPhysicalDeviceFeatures.multiDrawIndirect == VK_TRUE;
+	m_supportsDrawIndirectFirstInstance = supportedPhysicalDeviceFeatures.drawIndirectFirstInstance == VK_TRUE;
+	m_supportsPipelineStatisticsQueries = supportedPhysicalDeviceFeatures.pipelineStatisticsQuery == VK_TRUE && supportedPhysicalDeviceFeatures.inheritedQueries == VK_TRUE;
+
+	VkPhysicalDeviceProperties physicalDeviceProperties{ };
+	vkGetPhysicalDeviceProperties(m_physicalDevice, &physicalDeviceProperties);
+	m_timestampPeriod = physicalDeviceProperties.limits.timestampPeriod;
+
+	std::uint32_t queueFamilyCount = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, nullptr);
+
+	std::vector<VkQueueFamilyProperties> queueFamilies(queueFamilyCount);
+	vkGetPhysicalDeviceQueueFamilyProperties(m_physicalDevice, &queueFamilyCount, queueFamilies.data());
+	m_timestampValidBits = queueFamilies[m_queueFamilyIndices.graphicsFamilyIndex.value()].timestampValidBits;
+
 	VkPhysicalDeviceFeatures physicalDeviceFeatures{ };
 	physicalDeviceFeatures.geometryShader = VK_TRUE;
 	physicalDeviceFeatures.tessellationShader = VK_TRUE;
@@ -441,14 +608,50 @@ void VulkanContext::InitialiseDevice()
 	physicalDeviceFeatures.imageCubeArray = VK_TRUE;
 	physicalDeviceFeatures.shaderStorageImageMultisample = VK_TRUE;
 	physicalDeviceFeatures.shaderUniformBufferArrayDynamicIndexing = VK_TRUE;
+	physicalDeviceFeatures.multiDrawIndirect = m_supportsMultiDrawIndirect ? VK_TRUE : VK_FALSE;
+	physicalDeviceFeatures.drawIndirectFirstInstance = m_supportsDrawIndirectFirstInstance ? VK_TRUE : VK_FALSE;
+	physicalDeviceFeatures.pipelineStatisticsQuery = m_supportsPipelineStatisticsQueries ? VK_TRUE : VK_FALSE;
+	physicalDeviceFeatures.inheritedQueries = m_supportsPipelineStatisticsQueries ? VK_TRUE : VK_FALSE;
+
+	std::vector<const char*> deviceExtensions;
+
+	if (!IsHeadless())
+	{
+		deviceExtensions.assign(std::cbegin(s_RequiredDeviceExtensions), std::cend(s_RequiredDeviceExtensions));
+	}
+	m_supportsDescriptorIndexing = QueryDescriptorIndexingSupport(m_physicalDevice, m_descriptorIndexingLimits);
+
+	VkPhysicalDeviceDescriptorIndexingFeaturesEXT descriptorIndexingFeatures{ };
+	descriptorIndexingFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
+	if (m_supportsDescriptorIndexing)
+	{
+		deviceExtensions.insert(std::cend(deviceExtensions), std::cbegin(s_DescriptorIndexingDeviceExtensions), std::cend(s_DescriptorIndexingDeviceExtensions));
+
+		descriptorIndexingFeatures.runtimeDescriptorArray = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingPartiallyBound = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+		descriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+		descriptorIndexingFeatures.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+		descriptorIndexingFeatures.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+	}
+
+	m_supportsMemoryBudget = m_hasPhysicalDeviceProperties2 && SupportsDeviceExtensions(m_physicalDevice, s_MemoryBudgetDeviceExtensions);
+
+	if (m_supportsMemoryBudget)
+	{
+		deviceExtensions.insert(std::cend(deviceExtensions), std::cbegin(s_MemoryBudgetDeviceExtensions), std::cend(s_MemoryBudgetDeviceExtensions));
+	}
 
 	VkDeviceCreateInfo deviceCreateInfo{ };
 	deviceCreateInfo.sType = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
+	deviceCreateInfo.pNext = m_supportsDescriptorIndexing ? &descriptorIndexingFeatures : nullptr;
 	deviceCreateInfo.queueCreateInfoCount = static_cast<std::uint32_t>(deviceQueueCreateInfos.size());
 	deviceCreateInfo.pQueueCreateInfos = deviceQueueCreateInfos.data();
 	deviceCreateInfo.pEnabledFeatures = &physicalDeviceFeatures;
-	deviceCreateInfo.enabledExtensionCount = static_cast<std::uint32_t>(s_RequiredDeviceExtensions.size());
-	deviceCreateInfo.ppEnabledExtensionNames = s_RequiredDeviceExtensions.data();
+	deviceCreateInfo.enabledExtensionCount = static_cast<std::uint32_t>(deviceExtensions.size());
+	deviceCreateInfo.ppEnabledExtensionNames = deviceExtensions.data();
 
 	if constexpr (VulkanValidationLayers::AreEnabled())
 	{
@@ -509,6 +712,12 @@ void VulkanContext::InitialiseAllocator()
 	VmaAllocatorCreateInfo allocatorCreateInfo{ };
 	allocatorCreateInfo.physicalDevice = m_physicalDevice;
 	allocatorCreateInfo.device = m_logicalDevice;
+	allocatorCreateInfo.instance = m_instance;
+
+	if (m_supportsMemoryBudget)
+	{
+		allocatorCreateInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+	}
 
 	if (vmaCreateAllocator(&allocatorCreateInfo, &m_allocator) != VK_SUCCESS)
 	{
@@ -6,6 +6,9 @@
 #include <array>
 #include <cstdint>
 #include <optional>
+#include <ostream>
+#include <span>
+#include <string>
 #include <vector>
 
 #include <vma/vk_mem_alloc.h>
@@ -31,14 +34,30 @@ public:
 		std::optional<std::uint32_t> presentationFamilyIndex = std::nullopt;
 	};
 
+	struct DescriptorIndexingLimits
+	{
+		std::uint32_t maxStorageBuffers = 0;
+		std::uint32_t maxSampledImages = 0;
+	};
+
 private:
 	static constexpr std::array<const char*, 1u> s_RequiredDeviceExtensions{
 		VK_KHR_SWAPCHAIN_EXTENSION_NAME
 	};
 
+	static constexpr std::array<const char*, 2u> s_DescriptorIndexingDeviceExtensions{
+		VK_KHR_MAINTENANCE3_EXTENSION_NAME,
+		VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME
+	};
+
+	static constexpr std::array<const char*, 1u> s_MemoryBudgetDeviceExtensions{
+		VK_EXT_MEMORY_BUDGET_EXTENSION_NAME
+	};
+
 	VkInstance m_instance = VK_NULL_HANDLE;
+	bool m_hasPhysicalDeviceProperties2 = false;
 
-	const Window& m_window;
+	const Window* m_window = nullptr;
 	VkSurfaceKHR m_surface = VK_NULL_HANDLE;
 
 	VkPhysicalDevice m_physicalDevice = VK_NULL_HANDLE;
@@ -52,7 +71,19 @@ private:
 	VkQueue m_graphicsQueue = VK_NULL_HANDLE;
 	VkQueue m_presentationQueue = VK_NULL_HANDLE;
 
+	bool m_supportsMultiDrawIndirect = false;
+	bool m_supportsDrawIndirectFirstInstance = false;
+	bool m_supportsPipelineStatisticsQueries = false;
+	std::uint32_t m_timestampValidBits = 0;
+	float m_timestampPeriod = 0.0f;
+
+	bool m_supportsDescriptorIndexing = false;
+	DescriptorIndexingLimits m_descriptorIndexingLimits{ };
+
+	bool m_supportsMemoryBudget = false;
+
 public:
+	VulkanContext();
 	VulkanContext(const Window& window);
 	~VulkanContext() noexcept;
 
@@ -62,9 +93,15 @@ public:
 	void WaitOnGraphicsQueue() const;
 	void WaitOnPresentationQueue() const;
 
+	[[nodiscard]] std::vector<VmaBudget> GetMemoryBudgets() const;
+	void PrintMemoryBudgets(std::ostream& outputStream) const;
+	void WriteAllocatorStatistics(const std::string& filepath) const;
+
+	inline bool IsHeadless() const noexcept { return m_window == nullptr; }
 	inline VkSurfaceKHR GetSurface() const noexcept { return m_surface; }
 
 	inline VkPhysicalDevice GetPhysicalDevice() const noexcept { return m_physicalDevice; }
+	inline const VkPhysicalDeviceMemoryProperties& GetPhysicalDeviceMemoryProperties() const noexcept { return m_physicalDeviceMemoryProperties; }
 	inline VkDevice GetLogicalDevice() const noexcept { return m_logicalDevice; }
 
 	inline VkCommandPool GetCommandPool() const noexcept { return m_commandPool; }
@@ -74,11 +111,24 @@ public:
 	inline VkQueue GetGraphicsQueue() const noexcept { return m_graphicsQueue; }
 	inline VkQueue GetPresentationQueue() const noexcept { return m_presentationQueue; }
 
+	inline bool SupportsMultiDrawIndirect() const noexcept { return m_supportsMultiDrawIndirect; }
+	inline bool SupportsDrawIndirectFirstInstance() const noexcept { return m_supportsDrawIndirectFirstInstance; }
+	inline bool SupportsPipelineStatisticsQueries() const noexcept { return m_supportsPipelineStatisticsQueries; }
+	inline bool SupportsTimestampQueries() const noexcept { return m_timestampValidBits > 0 && m_timestampPeriod > 0.0f; }
+	inline std::uint32_t GetTimestampValidBits() const noexcept { return m_timestampValidBits; }
+	inline float GetTimestampPeriod() const noexcept { return m_timestampPeriod; }
+	inline bool SupportsDescriptorIndexing() const noexcept { return m_supportsDescriptorIndexing; }
+	inline const DescriptorIndexingLimits& GetDescriptorIndexingLimits() const noexcept { return m_descriptorIndexingLimits; }
+	inline bool SupportsMemoryBudget() const noexcept { return m_supportsMemoryBudget; }
+
 private:
+	explicit VulkanContext(const Window* const window);
+
 	static bool AreQueueFamilyIndicesComplete(const QueueFamilyIndices& queueFamilyIndices);
 
 	void InitialiseInstance();
 	[[nodiscard]] std::vector<const char*> GetRequiredInstanceExtensions() const;
+	[[nodiscard]] bool SupportsInstanceExtension(const char* const instanceExtensionName) const;
 	void DestroyInstance() noexcept;
 
 	void InitialiseSurface();
@@ -87,7 +137,8 @@ private:
 	void SelectPhysicalDevice();
 	[[nodiscard]] std::uint64_t GetPhysicalDeviceScore(const VkPhysicalDevice physicalDevice) const;
 	[[nodiscard]] QueueFamilyIndices FindQueueFamilyIndices(const VkPhysicalDevice physicalDevice) const;
-	bool SupportsRequiredDeviceExtensions(const VkPhysicalDevice physicalDevice) const;
+	bool SupportsDeviceExtensions(const VkPhysicalDevice physicalDevice, const std::span<const char* const> deviceExtensions) const;
+	[[nodiscard]] bool QueryDescriptorIndexingSupport(const VkPhysicalDevice physicalDevice, DescriptorIndexingLimits& descriptorIndexingLimits) const;
 
 	void InitialiseDevice();
 	void DestroyDevice();
@@ -4,7 +4,37 @@
 
 namespace vulkan_util
 {
-	void CreateBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaMemoryUsage memoryUsage, VkBuffer& buffer, VmaAllocation& bufferAllocation)
+	namespace
+	{
+		// Allocations carry their category name as VMA user data, so it shows up in vmaBuildStatsString and can be recovered on destruction.
+		[[nodiscard]] VmaAllocationCreateInfo CreateTrackedAllocationInfo(const VmaMemoryUsage memoryUsage, const MemoryTracker::Category memoryCategory) noexcept
+		{
+			VmaAllocationCreateInfo allocationCreateInfo{ };
+			allocationCreateInfo.usage = memoryUsage;
+			allocationCreateInfo.flags = VMA_ALLOCATION_CREATE_USER_DATA_COPY_STRING_BIT;
+			allocationCreateInfo.pUserData = const_cast<char*>(MemoryTracker::GetCategoryName(memoryCategory));
+
+			return allocationCreateInfo;
+		}
+
+		void RecordTrackedDeallocation(const VulkanContext& vulkanContext, const VmaAllocation allocation) noexcept
+		{
+			VmaAllocationInfo allocationInfo{ };
+			vmaGetAllocationInfo(vulkanContext.GetAllocator(), allocation, &allocationInfo);
+
+			if (allocationInfo.pUserData == nullptr)
+			{
+				return;
+			}
+
+			if (const auto memoryCategory = MemoryTracker::FindCategory(static_cast<const char*>(allocationInfo.pUserData)); memoryCategory.has_value())
+			{
+				MemoryTracker::Get().RecordDeallocation(memoryCategory.value(), allocationInfo.size);
+			}
+		}
+	}
+
+	void CreateBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaMemoryUsage memoryUsage, const MemoryTracker::Category memoryCategory, VkBuffer& buffer, VmaAllocation& bufferAllocation)
 	{
 		VkBufferCreateInfo bufferCreateInfo{ };
 		bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
@@ -12,13 +42,54 @@ namespace vulkan_util
 		bufferCreateInfo.usage = usageFlags;
 		bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-		VmaAllocationCreateInfo allocationCreateInfo{ };
-		allocationCreateInfo.usage = memoryUsage;
+		const VmaAllocationCreateInfo allocationCreateInfo = CreateTrackedAllocationInfo(memoryUsage, memoryCategory);
+		VmaAllocationInfo allocationInfo{ };
 
-		if (vmaCreateBuffer(vulkanContext.GetAllocator(), &bufferCreateInfo, &allocationCreateInfo, &buffer, &bufferAllocation, nullptr) != VK_SUCCESS)
+		if (vmaCreateBuffer(vulkanContext.GetAllocator(), &bufferCreateInfo, &allocationCreateInfo, &buffer, &bufferAllocation, &allocationInfo) != VK_SUCCESS)
 		{
 			throw std::runtime_error("Failed to create Vulkan buffer.");
 		}
+
+		MemoryTracker::Get().RecordAllocation(memoryCategory, allocationInfo.size);
+	}
+
+	void DestroyBuffer(const VulkanContext& vulkanContext, VkBuffer& buffer, VmaAllocation& bufferAllocation) noexcept
+	{
+		if (buffer == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
+		RecordTrackedDeallocation(vulkanContext, bufferAllocation);
+		vmaDestroyBuffer(vulkanContext.GetAllocator(), buffer, bufferAllocation);
+
+		buffer = VK_NULL_HANDLE;
+		bufferAllocation = VK_NULL_HANDLE;
+	}
+
+	void RebindBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaAllocation bufferAllocation, VkBuffer& buffer)
+	{
+		VkBufferCreateInfo bufferCreateInfo{ };
+		bufferCreateInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		bufferCreateInfo.size = size;
+		bufferCreateInfo.usage = usageFlags;
+		bufferCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+		VkBuffer reboundBuffer = VK_NULL_HANDLE;
+
+		if (vkCreateBuffer(vulkanContext.GetLogicalDevice(), &bufferCreateInfo, nullptr, &reboundBuffer) != VK_SUCCESS)
+		{
+			throw std::runtime_error("Failed to recreate Vulkan buffer.");
+		}
+
+		if (vmaBindBufferMemory(vulkanContext.GetAllocator(), bufferAllocation, reboundBuffer) != VK_SUCCESS)
+		{
+			vkDestroyBuffer(vulkanContext.GetLogicalDevice(), reboundBuffer, nullptr);
+
+			throw std::runtime_error("Failed to bind Vulkan buffer to its moved allocation.");
+		}
+
+		buffer = reboundBuffer;
 	}
 
 	void CopyBuffer(const VulkanContext& vulkanContext, const VkBuffer& sourceBuffer, const VkBuffer& destinationBuffer, const VkDeviceSize size)
@@ -73,7 +144,7 @@ namespace vulkan_util
 		commandBuffer = VK_NULL_HANDLE;
 	}
 
-	void CreateImage(const VulkanContext& vulkanContext, const std::uint32_t width, const std::uint32_t height, const VkFormat format, const VkImageTiling imageTiling, const VkImageUsageFlags imageUsage, const VmaMemoryUsage memoryUsage, VkImage& image, VmaAllocation& imageAlloaction)
+	void CreateImage(const VulkanContext& vulkanContext, const std::uint32_t width, const std::uint32_t height, const VkFormat format, const VkImageTiling imageTiling, const VkImageUsageFlags imageUsage, const VmaMemoryUsage memoryUsage, const MemoryTracker::Category memoryCategory, VkImage& image, VmaAllocation& imageAlloaction)
 	{
 		VkImageCreateInfo imageCreateInfo{ };
 		imageCreateInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
@@ -90,13 +161,29 @@ namespace vulkan_util
 		imageCreateInfo.samples = VK_SAMPLE_COUNT_1_BIT;
 		imageCreateInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
 
-		VmaAllocationCreateInfo allocationCreateInfo{ };
-		allocationCreateInfo.usage = memoryUsage;
+		const VmaAllocationCreateInfo allocationCreateInfo = CreateTrackedAllocationInfo(memoryUsage, memoryCategory);
+		VmaAllocationInfo allocationInfo{ };
 
-		if (vmaCreateImage(vulkanContext.GetAllocator(), &imageCreateInfo, &allocationCreateInfo, &image, &imageAlloaction, nullptr) != VK_SUCCESS)
+		if (vmaCreateImage(vulkanContext.GetAllocator(), &imageCreateInfo, &allocationCreateInfo, &image, &imageAlloaction, &allocationInfo) != VK_SUCCESS)
 		{
 			throw std::runtime_error("Failed to create Vulkan image.");
 		}
+
+		MemoryTracker::Get().RecordAllocation(memoryCategory, allocationInfo.size);
+	}
+
+	void DestroyImage(const VulkanContext& vulkanContext, VkImage& image, VmaAllocation& imageAllocation) noexcept
+	{
+		if (image == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
+		RecordTrackedDeallocation(vulkanContext, imageAllocation);
+		vmaDestroyImage(vulkanContext.GetAllocator(), image, imageAllocation);
+
+		image = VK_NULL_HANDLE;
+		imageAllocation = VK_NULL_HANDLE;
 	}
 
 	[[nodiscard]] VkImageView CreateImageView(const VulkanContext& vulkanContext, const VkImage image, const VkFormat format, const VkImageAspectFlags imageAspect)
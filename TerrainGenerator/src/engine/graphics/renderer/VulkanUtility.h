@@ -4,13 +4,17 @@
 #include <vulkan/vulkan.h>
 
 #include "VulkanContext.h"
+#include "../../utility/MemoryTracker.h"
 
 namespace vulkan_util
 {
-	extern void CreateBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaMemoryUsage memoryUsage, VkBuffer& buffer, VmaAllocation& bufferAllocation);
+	extern void CreateBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaMemoryUsage memoryUsage, const MemoryTracker::Category memoryCategory, VkBuffer& buffer, VmaAllocation& bufferAllocation);
+	extern void DestroyBuffer(const VulkanContext& vulkanContext, VkBuffer& buffer, VmaAllocation& bufferAllocation) noexcept;
+	extern void RebindBuffer(const VulkanContext& vulkanContext, const VkDeviceSize size, const VkBufferUsageFlags usageFlags, const VmaAllocation bufferAllocation, VkBuffer& buffer);
 	extern void CopyBuffer(const VulkanContext& vulkanContext, const VkBuffer& sourceBuffer, const VkBuffer& destinationBuffer, const VkDeviceSize size);
 
-	extern void CreateImage(const VulkanContext& vulkanContext, const std::uint32_t width, const std::uint32_t height, const VkFormat format, const VkImageTiling imageTiling, const VkImageUsageFlags imageUsage, const VmaMemoryUsage memoryUsage, VkImage& image, VmaAllocation& imageAlloaction);
+	extern void CreateImage(const VulkanContext& vulkanContext, const std::uint32_t width, const std::uint32_t height, const VkFormat format, const VkImageTiling imageTiling, const VkImageUsageFlags imageUsage, const VmaMemoryUsage memoryUsage, const MemoryTracker::Category memoryCategory, VkImage& image, VmaAllocation& imageAlloaction);
+	extern void DestroyImage(const VulkanContext& vulkanContext, VkImage& image, VmaAllocation& imageAllocation) noexcept;
 	[[nodiscard]] extern VkImageView CreateImageView(const VulkanContext& vulkanContext, const VkImage image, const VkFormat format, const VkImageAspectFlags imageAspect);
 	[[nodiscard]] extern VkFormat FindSupportedFormat(const VulkanContext& vulkanContext, const std::vector<VkFormat>& candidateFormats, const VkImageTiling imageTiling, const VkFormatFeatureFlags features);
 
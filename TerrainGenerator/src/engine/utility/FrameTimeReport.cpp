@@ -0,0 +1,109 @@
+#include "FrameTimeReport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+FrameTimeReport::FrameTimeReport(std::vector<double> frameTimesMilliseconds)
+	: m_frameTimes(std::move(frameTimesMilliseconds))
+{
+	if (m_frameTimes.empty())
+	{
+		return;
+	}
+
+	std::vector<double> sortedFrameTimes = m_frameTimes;
+	std::sort(std::begin(sortedFrameTimes), std::end(sortedFrameTimes));
+
+	m_totalTime = std::accumulate(std::cbegin(sortedFrameTimes), std::cend(sortedFrameTimes), 0.0);
+	m_meanTime = m_totalTime / static_cast<double>(sortedFrameTimes.size());
+	m_p50Time = GetPercentile(sortedFrameTimes, 50.0);
+	m_p95Time = GetPercentile(sortedFrameTimes, 95.0);
+	m_p99Time = GetPercentile(sortedFrameTimes, 99.0);
+	m_maxTime = sortedFrameTimes.back();
+
+	m_hitchThreshold = m_p50Time * s_HitchMedianMultiplier;
+	m_hitchCount = static_cast<std::size_t>(std::count_if(std::cbegin(m_frameTimes), std::cend(m_frameTimes), [this](const double frameTime)
+	{
+		return frameTime > m_hitchThreshold;
+	}));
+}
+
+void FrameTimeReport::Print(std::ostream& outputStream) const
+{
+	outputStream << "Frames: " << m_frameTimes.size() << " (" << m_totalTime << " ms)\n"
+		<< "Mean: " << m_meanTime << " ms\n"
+		<< "p50: " << m_p50Time << " ms, p95: " << m_p95Time << " ms, p99: " << m_p99Time << " ms, max: " << m_maxTime << " ms\n"
+		<< "Hitches (> " << m_hitchThreshold << " ms): " << m_hitchCount << "\n";
+}
+
+void FrameTimeReport::WriteJSON(const std::string& filepath, const std::string& name) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open frame time report file " + filepath + " for writing.");
+	}
+
+	file.precision(6);
+	file << std::fixed;
+
+	file << "{\n"
+		<< "\t\"name\": \"" << EscapeJSONString(name) << "\",\n"
+		<< "\t\"frame_count\": " << m_frameTimes.size() << ",\n"
+		<< "\t\"total_ms\": " << m_totalTime << ",\n"
+		<< "\t\"mean_ms\": " << m_meanTime << ",\n"
+		<< "\t\"p50_ms\": " << m_p50Time << ",\n"
+		<< "\t\"p95_ms\": " << m_p95Time << ",\n"
+		<< "\t\"p99_ms\": " << m_p99Time << ",\n"
+		<< "\t\"max_ms\": " << m_maxTime << ",\n"
+		<< "\t\"hitch_threshold_ms\": " << m_hitchThreshold << ",\n"
+		<< "\t\"hitch_count\": " << m_hitchCount << ",\n"
+		<< "\t\"frame_times_ms\": [";
+
+	for (std::size_t i = 0; i < m_frameTimes.size(); ++i)
+	{
+		file << (i == 0 ? "" : ", ") << m_frameTimes[i];
+	}
+
+	file << "]\n}\n";
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write frame time report file " + filepath + ".");
+	}
+}
+
+[[nodiscard]] std::string FrameTimeReport::EscapeJSONString(const std::string& value)
+{
+	std::string escapedValue;
+	escapedValue.reserve(value.length());
+
+	for (const char character : value)
+	{
+		if (character == '"' || character == '\\')
+		{
+			escapedValue.push_back('\\');
+		}
+
+		escapedValue.push_back(character);
+	}
+
+	return escapedValue;
+}
+
+[[nodiscard]] double FrameTimeReport::GetPercentile(const std::vector<double>& sortedValues, const double percentile) noexcept
+{
+	if (sortedValues.empty())
+	{
+		return 0.0;
+	}
+
+	const std::size_t rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(sortedValues.size())));
+
+	return sortedValues[std::clamp<std::size_t>(rank, 1u, sortedValues.size()) - 1u];
+}
\ No newline at end of file
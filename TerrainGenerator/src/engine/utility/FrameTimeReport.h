@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class FrameTimeReport
+{
+private:
+	static constexpr double s_HitchMedianMultiplier = 2.0;
+
+	std::vector<double> m_frameTimes;
+
+	double m_totalTime = 0.0;
+	double m_meanTime = 0.0;
+	double m_p50Time = 0.0;
+	double m_p95Time = 0.0;
+	double m_p99Time = 0.0;
+	double m_maxTime = 0.0;
+
+	double m_hitchThreshold = 0.0;
+	std::size_t m_hitchCount = 0u;
+
+public:
+	explicit FrameTimeReport(std::vector<double> frameTimesMilliseconds);
+	~FrameTimeReport() noexcept = default;
+
+	void Print(std::ostream& outputStream) const;
+	void WriteJSON(const std::string& filepath, const std::string& name) const;
+
+	inline const std::vector<double>& GetFrameTimes() const noexcept { return m_frameTimes; }
+	inline std::size_t GetFrameCount() const noexcept { return m_frameTimes.size(); }
+
+	inline double GetTotalTime() const noexcept { return m_totalTime; }
+	inline double GetMeanTime() const noexcept { return m_meanTime; }
+	inline double GetP50Time() const noexcept { return m_p50Time; }
+	inline double GetP95Time() const noexcept { return m_p95Time; }
+	inline double GetP99Time() const noexcept { return m_p99Time; }
+	inline double GetMaxTime() const noexcept { return m_maxTime; }
+
+	inline double GetHitchThreshold() const noexcept { return m_hitchThreshold; }
+	inline std::size_t GetHitchCount() const noexcept { return m_hitchCount; }
+
+private:
+	[[nodiscard]] static std::string EscapeJSONString(const std::string& value);
+	[[nodiscard]] static double GetPercentile(const std::vector<double>& sortedValues, const double percentile) noexcept;
+};
\ No newline at end of file
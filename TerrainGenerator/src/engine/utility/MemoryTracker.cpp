@@ -0,0 +1,103 @@
+#include "MemoryTracker.h"
+
+#include <iomanip>
+
+[[nodiscard]] MemoryTracker& MemoryTracker::Get()
+{
+	static MemoryTracker memoryTracker;
+
+	return memoryTracker;
+}
+
+[[nodiscard]] std::optional<MemoryTracker::Category> MemoryTracker::FindCategory(const std::string_view& name) noexcept
+{
+	for (std::size_t i = 0; i < s_CategoryCount; ++i)
+	{
+		if (name == s_CategoryNames[i])
+		{
+			return static_cast<Category>(i);
+		}
+	}
+
+	return std::nullopt;
+}
+
+void MemoryTracker::RecordAllocation(const Category category, const std::uint64_t byteCount) noexcept
+{
+	Counters& counters = m_counters[static_cast<std::size_t>(category)];
+
+	const std::uint64_t currentBytes = counters.currentBytes.fetch_add(byteCount, std::memory_order_relaxed) + byteCount;
+	counters.allocationCount.fetch_add(1u, std::memory_order_relaxed);
+
+	std::uint64_t peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+
+	while (currentBytes > peakBytes && !counters.peakBytes.compare_exchange_weak(peakBytes, currentBytes, std::memory_order_relaxed))
+	{ }
+}
+
+void MemoryTracker::RecordDeallocation(const Category category, const std::uint64_t byteCount) noexcept
+{
+	Counters& counters = m_counters[static_cast<std::size_t>(category)];
+
+	counters.currentBytes.fetch_sub(byteCount, std::memory_order_relaxed);
+	counters.allocationCount.fetch_sub(1u, std::memory_order_relaxed);
+}
+
+[[nodiscard]] MemoryTracker::Usage MemoryTracker::GetUsage(const Category category) const noexcept
+{
+	const Counters& counters = m_counters[static_cast<std::size_t>(category)];
+
+	return Usage{
+		counters.currentBytes.load(std::memory_order_relaxed),
+		counters.peakBytes.load(std::memory_order_relaxed),
+		counters.allocationCount.load(std::memory_order_relaxed)
+	};
+}
+
+[[nodiscard]] MemoryTracker::Usage MemoryTracker::GetTotalUsage(const bool isGPU) const noexcept
+{
+	Usage totalUsage{ };
+
+	for (std::size_t i = 0; i < s_CategoryCount; ++i)
+	{
+		if (IsGPUCategory(static_cast<Category>(i)) != isGPU)
+		{
+			continue;
+		}
+
+		const Usage usage = GetUsage(static_cast<Category>(i));
+
+		totalUsage.currentBytes += usage.currentBytes;
+		totalUsage.peakBytes += usage.peakBytes;
+		totalUsage.allocationCount += usage.allocationCount;
+	}
+
+	return totalUsage;
+}
+
+void MemoryTracker::Print(std::ostream& outputStream) const
+{
+	constexpr double BytesPerKibibyte = 1'024.0;
+
+	const auto printUsage = [&outputStream](const char* name, const Usage& usage)
+	{
+		outputStream << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(14) << static_cast<double>(usage.currentBytes) / BytesPerKibibyte
+			<< std::setw(14) << static_cast<double>(usage.peakBytes) / BytesPerKibibyte
+			<< std::setw(14) << usage.allocationCount << "\n";
+	};
+
+	outputStream << std::left << std::setw(20) << "Category" << std::right
+		<< std::setw(14) << "Live KiB"
+		<< std::setw(14) << "Peak KiB"
+		<< std::setw(14) << "Allocations" << "\n";
+
+	for (std::size_t i = 0; i < s_CategoryCount; ++i)
+	{
+		printUsage(s_CategoryNames[i], GetUsage(static_cast<Category>(i)));
+	}
+
+	// Per-category peaks can occur at different times, so the summed peaks are an upper bound.
+	printUsage("GPU total", GetTotalUsage(true));
+	printUsage("CPU total", GetTotalUsage(false));
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "interfaces/INoncopyable.h"
+#include "interfaces/INonmovable.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+class MemoryTracker
+	: private INoncopyable, private INonmovable
+{
+public:
+	enum class Category
+		: std::size_t
+	{
+		VertexBuffers,
+		IndexBuffers,
+		IndirectBuffers,
+		UniformBuffers,
+		StorageBuffers,
+		StagingBuffers,
+		ReadbackBuffers,
+		DepthBuffers,
+		ColourTargets,
+		HeightMaps,
+		MeshVertices,
+		MeshIndices,
+		Count
+	};
+
+	struct Usage
+	{
+		std::uint64_t currentBytes = 0u;
+		std::uint64_t peakBytes = 0u;
+		std::uint64_t allocationCount = 0u;
+	};
+
+private:
+	struct Counters
+	{
+		std::atomic<std::uint64_t> currentBytes = 0u;
+		std::atomic<std::uint64_t> peakBytes = 0u;
+		std::atomic<std::uint64_t> allocationCount = 0u;
+	};
+
+	static constexpr std::size_t s_CategoryCount = static_cast<std::underlying_type_t<Category>>(Category::Count);
+	static constexpr Category s_FirstCPUCategory = Category::HeightMaps;
+
+	static constexpr std::array<const char*, s_CategoryCount> s_CategoryNames{
+		"Vertex buffers",
+		"Index buffers",
+		"Indirect buffers",
+		"Uniform buffers",
+		"Storage buffers",
+		"Staging buffers",
+		"Readback buffers",
+		"Depth buffers",
+		"Colour targets",
+		"Height maps",
+		"Mesh vertices",
+		"Mesh indices"
+	};
+
+	std::array<Counters, s_CategoryCount> m_counters{ };
+
+public:
+	[[nodiscard]] static MemoryTracker& Get();
+	[[nodiscard]] static std::optional<Category> FindCategory(const std::string_view& name) noexcept;
+
+	static constexpr const char* GetCategoryName(const Category category) noexcept { return s_CategoryNames[static_cast<std::size_t>(category)]; }
+	static constexpr bool IsGPUCategory(const Category category) noexcept { return static_cast<std::size_t>(category) < static_cast<std::size_t>(s_FirstCPUCategory); }
+
+	void RecordAllocation(const Category category, const std::uint64_t byteCount) noexcept;
+	void RecordDeallocation(const Category category, const std::uint64_t byteCount) noexcept;
+
+	[[nodiscard]] Usage GetUsage(const Category category) const noexcept;
+	[[nodiscard]] Usage GetTotalUsage(const bool isGPU) const noexcept;
+
+	void Print(std::ostream& outputStream) const;
+
+private:
+	MemoryTracker() = default;
+	~MemoryTracker() noexcept = default;
+};
+
+template <typename T, MemoryTracker::Category C>
+class TrackingAllocator
+{
+public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind
+	{
+		using other = TrackingAllocator<U, C>;
+	};
+
+	TrackingAllocator() noexcept = default;
+
+	template <typename U>
+	TrackingAllocator(const TrackingAllocator<U, C>&) noexcept
+	{ }
+
+	[[nodiscard]] T* allocate(const std::size_t count)
+	{
+		T* const data = std::allocator<T>{ }.allocate(count);
+		MemoryTracker::Get().RecordAllocation(C, count * sizeof(T));
+
+		return data;
+	}
+
+	void deallocate(T* const data, const std::size_t count) noexcept
+	{
+		MemoryTracker::Get().RecordDeallocation(C, count * sizeof(T));
+		std::allocator<T>{ }.deallocate(data, count);
+	}
+
+	template <typename U>
+	bool operator ==(const TrackingAllocator<U, C>&) const noexcept { return true; }
+};
+
+template <typename T, MemoryTracker::Category C>
+using TrackedVector = std::vector<T, TrackingAllocator<T, C>>;
\ No newline at end of file
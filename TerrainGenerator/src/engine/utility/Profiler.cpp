@@ -0,0 +1,255 @@
+#include "Profiler.h"
+
+#include <cstdio>
+#include <fstream>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+
+namespace
+{
+	std::string EscapeJSONString(const std::string_view text)
+	{
+		std::string escapedText;
+		escapedText.reserve(text.size());
+
+		for (const char character : text)
+		{
+			switch (character)
+			{
+			case '"':
+				escapedText += "\\\"";
+
+				break;
+
+			case '\\':
+				escapedText += "\\\\";
+
+				break;
+
+			case '\n':
+				escapedText += "\\n";
+
+				break;
+
+			case '\r':
+				escapedText += "\\r";
+
+				break;
+
+			case '\t':
+				escapedText += "\\t";
+
+				break;
+
+			default:
+				if (static_cast<unsigned char>(character) < 0x20u)
+				{
+					char unicodeEscape[7]{ };
+					std::snprintf(unicodeEscape, sizeof(unicodeEscape), "\\u%04x", static_cast<unsigned int>(character));
+
+					escapedText += unicodeEscape;
+				}
+				else
+				{
+					escapedText += character;
+				}
+
+				break;
+			}
+		}
+
+		return escapedText;
+	}
+}
+
+thread_local Profiler::ThreadBuffer* Profiler::s_threadBuffer = nullptr;
+
+Profiler::Zone::Zone(const char* name) noexcept
+	: m_name(name), m_startNanoseconds(Profiler::Get().GetTimestamp())
+{ }
+
+Profiler::Zone::~Zone() noexcept
+{
+	Profiler& profiler = Profiler::Get();
+
+	profiler.RecordEvent(Event{ m_name, m_startNanoseconds, profiler.GetTimestamp() });
+}
+
+Profiler::ThreadBuffer::~ThreadBuffer() noexcept
+{
+	EventBlock* block = firstBlock->nextBlock.load(std::memory_order_relaxed);
+
+	while (block != nullptr)
+	{
+		EventBlock* const nextBlock = block->nextBlock.load(std::memory_order_relaxed);
+		delete block;
+
+		block = nextBlock;
+	}
+}
+
+[[nodiscard]] Profiler& Profiler::Get()
+{
+	static Profiler profiler;
+
+	return profiler;
+}
+
+void Profiler::SetThreadName(const std::string& threadName)
+{
+	ThreadBuffer& threadBuffer = GetThreadBuffer();
+
+	const std::scoped_lock lock(m_threadBufferMutex);
+	threadBuffer.threadName = threadName;
+}
+
+void Profiler::RecordEvent(const Event& event) noexcept
+{
+	try
+	{
+		AppendEvent(GetThreadBuffer(), event);
+	}
+	catch (...)
+	{ }
+}
+
+[[nodiscard]] std::uint32_t Profiler::CreateTrack(const std::string& trackName)
+{
+	const std::scoped_lock lock(m_threadBufferMutex);
+
+	ThreadBuffer& trackBuffer = CreateThreadBuffer(m_threadBuffers);
+	trackBuffer.threadName = trackName;
+
+	return trackBuffer.threadID;
+}
+
+void Profiler::RecordTrackEvents(const std::uint32_t trackID, const std::span<const Event> events)
+{
+	const std::scoped_lock lock(m_threadBufferMutex);
+
+	if (trackID == 0u || trackID > m_threadBuffers.size())
+	{
+		throw std::out_of_range("Invalid profiler track ID.");
+	}
+
+	for (const auto& event : events)
+	{
+		AppendEvent(*m_threadBuffers[trackID - 1u], event);
+	}
+}
+
+void Profiler::WriteChromeTrace(const std::string& filepath) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open profiler trace file " + filepath + " for writing.");
+	}
+
+	constexpr double NanosecondsPerMicrosecond = 1'000.0;
+
+	file.precision(3);
+	file << std::fixed << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+	bool isFirstEvent = true;
+	const std::scoped_lock lock(m_threadBufferMutex);
+
+	for (const auto& threadBuffer : m_threadBuffers)
+	{
+		file << (isFirstEvent ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadBuffer->threadID
+			<< ",\"args\":{\"name\":\"" << (threadBuffer->threadName.empty() ? "Thread " + std::to_string(threadBuffer->threadID) : EscapeJSONString(threadBuffer->threadName)) << "\"}}";
+		isFirstEvent = false;
+
+		for (const EventBlock* block = threadBuffer->firstBlock.get(); block != nullptr; block = block->nextBlock.load(std::memory_order_acquire))
+		{
+			const std::size_t eventCount = block->eventCount.load(std::memory_order_acquire);
+
+			for (std::size_t i = 0; i < eventCount; ++i)
+			{
+				const Event& event = block->events[i];
+
+				file << ",\n{\"name\":\"" << EscapeJSONString(event.name) << "\",\"cat\":\"zone\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadBuffer->threadID
+					<< ",\"ts\":" << event.startNanoseconds / NanosecondsPerMicrosecond
+					<< ",\"dur\":" << (event.endNanoseconds - event.startNanoseconds) / NanosecondsPerMicrosecond << "}";
+			}
+		}
+
+		const std::uint64_t droppedEventCount = threadBuffer->droppedEventCount.load(std::memory_order_relaxed);
+
+		if (droppedEventCount > 0u)
+		{
+			file << ",\n{\"name\":\"dropped_events\",\"ph\":\"C\",\"pid\":1,\"tid\":" << threadBuffer->threadID
+				<< ",\"ts\":0,\"args\":{\"count\":" << droppedEventCount << "}}";
+		}
+	}
+
+	file << "\n]}\n";
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write profiler trace file " + filepath + ".");
+	}
+}
+
+[[nodiscard]] std::uint64_t Profiler::GetTimestamp() const noexcept
+{
+	return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_epoch).count());
+}
+
+[[nodiscard]] Profiler::ThreadBuffer& Profiler::CreateThreadBuffer(std::vector<std::unique_ptr<ThreadBuffer>>& threadBuffers)
+{
+	threadBuffers.push_back(std::make_unique<ThreadBuffer>());
+	threadBuffers.back()->threadID = static_cast<std::uint32_t>(threadBuffers.size());
+
+	return *threadBuffers.back();
+}
+
+void Profiler::AppendEvent(ThreadBuffer& threadBuffer, const Event& event) noexcept
+{
+	EventBlock* block = threadBuffer.currentBlock;
+	const std::size_t eventIndex = block->eventCount.load(std::memory_order_relaxed);
+
+	if (eventIndex == s_EventsPerBlock)
+	{
+		if (threadBuffer.blockCount == s_MaxBlocksPerThread)
+		{
+			threadBuffer.droppedEventCount.fetch_add(1u, std::memory_order_relaxed);
+
+			return;
+		}
+
+		EventBlock* const nextBlock = new (std::nothrow) EventBlock();
+
+		if (nextBlock == nullptr)
+		{
+			threadBuffer.droppedEventCount.fetch_add(1u, std::memory_order_relaxed);
+
+			return;
+		}
+
+		nextBlock->events[0] = event;
+		nextBlock->eventCount.store(1u, std::memory_order_relaxed);
+
+		block->nextBlock.store(nextBlock, std::memory_order_release);
+		threadBuffer.currentBlock = nextBlock;
+		++threadBuffer.blockCount;
+
+		return;
+	}
+
+	block->events[eventIndex] = event;
+	block->eventCount.store(eventIndex + 1u, std::memory_order_release);
+}
+
+[[nodiscard]] Profiler::ThreadBuffer& Profiler::GetThreadBuffer()
+{
+	if (s_threadBuffer == nullptr)
+	{
+		const std::scoped_lock lock(m_threadBufferMutex);
+		s_threadBuffer = &CreateThreadBuffer(m_threadBuffers);
+	}
+
+	return *s_threadBuffer;
+}
\ No newline at end of file
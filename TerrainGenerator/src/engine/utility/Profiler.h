@@ -0,0 +1,112 @@
+#pragma once
+
+#include "interfaces/INoncopyable.h"
+#include "interfaces/INonmovable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+// Zones are only recorded when ENABLE_PROFILER is defined; otherwise the macros expand to nothing.
+#ifdef ENABLE_PROFILER
+	#define PROFILE_CONCATENATE_IMPLEMENTATION(a, b) a ## b
+	#define PROFILE_CONCATENATE(a, b) PROFILE_CONCATENATE_IMPLEMENTATION(a, b)
+
+	#define PROFILE_SCOPE(name) const Profiler::Zone PROFILE_CONCATENATE(profileZone, __LINE__)(name)
+	#define PROFILE_THREAD_NAME(name) Profiler::Get().SetThreadName(name)
+	#define PROFILE_WRITE_TRACE(filepath) Profiler::Get().WriteChromeTrace(filepath)
+#else
+	#define PROFILE_SCOPE(name) static_cast<void>(0)
+	#define PROFILE_THREAD_NAME(name) static_cast<void>(0)
+	#define PROFILE_WRITE_TRACE(filepath) static_cast<void>(0)
+#endif
+
+class Profiler
+	: private INoncopyable, private INonmovable
+{
+public:
+	struct Event
+	{
+		const char* name = nullptr;
+
+		std::uint64_t startNanoseconds = 0u;
+		std::uint64_t endNanoseconds = 0u;
+	};
+
+	class Zone
+		: private INoncopyable, private INonmovable
+	{
+	private:
+		const char* m_name;
+		std::uint64_t m_startNanoseconds;
+
+	public:
+		explicit Zone(const char* name) noexcept;
+		~Zone() noexcept;
+	};
+
+private:
+	static constexpr const char* s_DefaultTraceFilepath = "profiler_trace.json";
+
+	static constexpr std::size_t s_EventsPerBlock = 4'096u;
+	static constexpr std::size_t s_MaxBlocksPerThread = 256u;
+
+	struct EventBlock
+	{
+		std::array<Event, s_EventsPerBlock> events{ };
+		std::atomic<std::size_t> eventCount = 0u;
+
+		std::atomic<EventBlock*> nextBlock = nullptr;
+	};
+
+	struct ThreadBuffer
+	{
+		std::uint32_t threadID = 0u;
+		std::string threadName;
+
+		std::unique_ptr<EventBlock> firstBlock = std::make_unique<EventBlock>();
+		EventBlock* currentBlock = firstBlock.get();
+		std::size_t blockCount = 1u;
+
+		std::atomic<std::uint64_t> droppedEventCount = 0u;
+
+		~ThreadBuffer() noexcept;
+	};
+
+	static thread_local ThreadBuffer* s_threadBuffer;
+
+	const std::chrono::steady_clock::time_point m_epoch = std::chrono::steady_clock::now();
+
+	std::vector<std::unique_ptr<ThreadBuffer>> m_threadBuffers;
+	mutable std::mutex m_threadBufferMutex;
+
+public:
+	[[nodiscard]] static Profiler& Get();
+	static constexpr const char* GetDefaultTraceFilepath() noexcept { return s_DefaultTraceFilepath; }
+
+	void SetThreadName(const std::string& threadName);
+	void RecordEvent(const Event& event) noexcept;
+
+	[[nodiscard]] std::uint32_t CreateTrack(const std::string& trackName);
+	void RecordTrackEvents(const std::uint32_t trackID, const std::span<const Event> events);
+
+	void WriteChromeTrace(const std::string& filepath) const;
+
+	[[nodiscard]] std::uint64_t GetTimestamp() const noexcept;
+
+private:
+	Profiler() = default;
+	~Profiler() noexcept = default;
+
+	[[nodiscard]] static ThreadBuffer& CreateThreadBuffer(std::vector<std::unique_ptr<ThreadBuffer>>& threadBuffers);
+	static void AppendEvent(ThreadBuffer& threadBuffer, const Event& event) noexcept;
+
+	[[nodiscard]] ThreadBuffer& GetThreadBuffer();
+};
\ No newline at end of file
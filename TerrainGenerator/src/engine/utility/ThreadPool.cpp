@@ -0,0 +1,110 @@
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include "Profiler.h"
+
+ThreadPool::ThreadPool(const std::size_t threadCount)
+{
+	const std::size_t workerCount = std::max(threadCount, std::size_t{ 1u });
+	m_workers.reserve(workerCount);
+
+	for (std::size_t i = 0; i < workerCount; ++i)
+	{
+		m_workers.emplace_back([this]() { ProcessTasks(); });
+	}
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+	{
+		const std::scoped_lock lock(m_taskMutex);
+		m_isStopping = true;
+	}
+
+	m_taskCondition.notify_all();
+
+	for (auto& worker : m_workers)
+	{
+		worker.join();
+	}
+}
+
+void ThreadPool::ParallelFor(const std::size_t taskCount, const std::function<void(std::size_t)>& task)
+{
+	std::size_t remainingTaskCount = taskCount;
+	std::exception_ptr firstException = nullptr;
+
+	std::mutex completionMutex;
+	std::condition_variable completionCondition;
+
+	{
+		const std::scoped_lock lock(m_taskMutex);
+
+		for (std::size_t i = 0; i < taskCount; ++i)
+		{
+			m_tasks.push([&, i]()
+			{
+				std::exception_ptr taskException = nullptr;
+
+				try
+				{
+					task(i);
+				}
+				catch (...)
+				{
+					taskException = std::current_exception();
+				}
+
+				const std::scoped_lock completionLock(completionMutex);
+
+				if (taskException != nullptr && firstException == nullptr)
+				{
+					firstException = taskException;
+				}
+
+				if (--remainingTaskCount == 0)
+				{
+					completionCondition.notify_one();
+				}
+			});
+		}
+	}
+
+	m_taskCondition.notify_all();
+
+	std::unique_lock completionLock(completionMutex);
+	completionCondition.wait(completionLock, [&remainingTaskCount]() { return remainingTaskCount == 0; });
+
+	if (firstException != nullptr)
+	{
+		std::rethrow_exception(firstException);
+	}
+}
+
+void ThreadPool::ProcessTasks()
+{
+	PROFILE_THREAD_NAME("Worker");
+
+	while (true)
+	{
+		std::function<void()> task;
+
+		{
+			std::unique_lock lock(m_taskMutex);
+			m_taskCondition.wait(lock, [this]() { return m_isStopping || !m_tasks.empty(); });
+
+			if (m_isStopping && m_tasks.empty())
+			{
+				return;
+			}
+
+			task = std::move(m_tasks.front());
+			m_tasks.pop();
+		}
+
+		task();
+	}
+}
\ No newline at end of file
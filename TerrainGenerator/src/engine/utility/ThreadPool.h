@@ -0,0 +1,58 @@
+#pragma once
+
+#include "interfaces/INoncopyable.h"
+#include "interfaces/INonmovable.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class ThreadPool
+	: private INoncopyable, private INonmovable
+{
+private:
+	std::vector<std::thread> m_workers;
+
+	std::queue<std::function<void()>> m_tasks;
+	std::mutex m_taskMutex;
+	std::condition_variable m_taskCondition;
+
+	bool m_isStopping = false;
+
+public:
+	explicit ThreadPool(const std::size_t threadCount);
+	~ThreadPool() noexcept;
+
+	void ParallelFor(const std::size_t taskCount, const std::function<void(std::size_t)>& task);
+
+	template <typename F>
+	[[nodiscard]] std::future<std::invoke_result_t<F>> Enqueue(F&& task)
+	{
+		using Result = std::invoke_result_t<F>;
+
+		const auto packagedTask = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+		std::future<Result> result = packagedTask->get_future();
+
+		{
+			const std::scoped_lock lock(m_taskMutex);
+			m_tasks.push([packagedTask]() { (*packagedTask)(); });
+		}
+
+		m_taskCondition.notify_one();
+
+		return result;
+	}
+
+	inline std::size_t GetThreadCount() const noexcept { return m_workers.size(); }
+
+private:
+	void ProcessTasks();
+};
\ No newline at end of file
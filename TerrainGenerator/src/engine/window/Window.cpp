@@ -128,6 +128,11 @@ void Window::SetBordered(const bool isBordered) const
 	SDL_SetWindowBordered(m_windowHandle, isBordered ? SDL_TRUE : SDL_FALSE);
 }
 
+void Window::SetTitle(const std::string_view& title) const
+{
+	SDL_SetWindowTitle(m_windowHandle, title.data());
+}
+
 VkSurfaceKHR Window::CreateVulkanSurface(const VkInstance& vulkanInstance) const
 {
 	VkSurfaceKHR surface = VK_NULL_HANDLE;
@@ -39,6 +39,7 @@ public:
 
 	void SetIcon(const std::string_view& iconFilepath) const;
 	void SetBordered(const bool isBordered) const;
+	void SetTitle(const std::string_view& title) const;
 	
 	[[nodiscard]] VkSurfaceKHR CreateVulkanSurface(const VkInstance& vulkanInstance) const;
 
@@ -11,39 +11,56 @@ Camera3D::Camera3D(const glm::vec3& position, const glm::vec3& up, const float y
 	UpdateVectors();
 }
 
-void Camera3D::ProcessInput()
+[[nodiscard]] Camera3D::InputState Camera3D::SampleInput()
 {
 	const Uint8* keyStates = SDL_GetKeyboardState(nullptr);
 
+	int relativeMouseX = 0;
+	int relativeMouseY = 0;
+	SDL_GetRelativeMouseState(&relativeMouseX, &relativeMouseY);
+
+	return InputState{
+		.moveForward = keyStates[SDL_SCANCODE_W] != 0,
+		.moveBackward = keyStates[SDL_SCANCODE_S] != 0,
+		.moveLeft = keyStates[SDL_SCANCODE_A] != 0,
+		.moveRight = keyStates[SDL_SCANCODE_D] != 0,
+		.isSprinting = keyStates[SDL_SCANCODE_LSHIFT] != 0,
+		.mouseDelta = glm::vec2{ relativeMouseX, relativeMouseY }
+	};
+}
+
+void Camera3D::ProcessInput()
+{
+	ApplyInput(SampleInput());
+}
+
+void Camera3D::ApplyInput(const InputState& input)
+{
 	m_velocity = glm::vec3{ 0.0f, 0.0f, 0.0f };
-	m_movementSpeed = keyStates[SDL_SCANCODE_LSHIFT] ? s_DefaultSpeed * 4.0f : s_DefaultSpeed;
+	m_movementSpeed = input.isSprinting ? s_DefaultSpeed * 4.0f : s_DefaultSpeed;
 
-	if (keyStates[SDL_SCANCODE_W])
+	if (input.moveForward)
 	{
 		m_velocity += m_front * m_movementSpeed;
 	}
 
-	if (keyStates[SDL_SCANCODE_S])
+	if (input.moveBackward)
 	{
 		m_velocity -= m_front * m_movementSpeed;
 	}
 
-	if (keyStates[SDL_SCANCODE_A])
+	if (input.moveLeft)
 	{
 		m_velocity += m_right * m_movementSpeed;
 	}
 
-	if (keyStates[SDL_SCANCODE_D])
+	if (input.moveRight)
 	{
 		m_velocity -= m_right * m_movementSpeed;
 	}
 
-	int relativeMouseX = 0;
-	int relativeMouseY = 0;
-	SDL_GetRelativeMouseState(&relativeMouseX, &relativeMouseY);
-	
-	const float xOffset = relativeMouseX * m_mouseSensitivity;
-	const float yOffset = relativeMouseY * m_mouseSensitivity;
+	const float xOffset = input.mouseDelta.x * m_mouseSensitivity;
+	const float yOffset = input.mouseDelta.y * m_mouseSensitivity;
 	m_yaw -= xOffset;
 	m_pitch -= yOffset;
 
@@ -60,6 +77,17 @@ void Camera3D::Update(const float deltaTime)
 	m_position += m_velocity * deltaTime;
 }
 
+void Camera3D::SetPose(const glm::vec3& position, const float yaw, const float pitch)
+{
+	m_position = position;
+	m_velocity = glm::vec3{ 0.0f, 0.0f, 0.0f };
+
+	m_yaw = yaw;
+	m_pitch = pitch;
+
+	UpdateVectors();
+}
+
 void Camera3D::UpdateVectors()
 {
 	glm::vec3 updatedFront{
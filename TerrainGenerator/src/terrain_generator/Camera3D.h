@@ -7,6 +7,18 @@
 
 class Camera3D
 {
+public:
+	struct InputState
+	{
+		bool moveForward = false;
+		bool moveBackward = false;
+		bool moveLeft = false;
+		bool moveRight = false;
+		bool isSprinting = false;
+
+		glm::vec2 mouseDelta{ 0.0f, 0.0f };
+	};
+
 private:
 	static constexpr float s_DefaultYaw = 90.0f;
 	static constexpr float s_DefaultPitch = 0.0f;
@@ -33,12 +45,19 @@ public:
 	Camera3D(const glm::vec3& position = glm::vec3{ 0.0f, 0.0f, 0.0f }, const glm::vec3& up = glm::vec3{ 0.0f, 1.0f, 0.0f }, const float yaw = s_DefaultYaw, const float pitch = s_DefaultPitch);
 	~Camera3D() noexcept = default;
 
+	[[nodiscard]] static InputState SampleInput();
+
 	void ProcessInput();
+	void ApplyInput(const InputState& input);
 	void Update(const float deltaTime);
 
+	void SetPose(const glm::vec3& position, const float yaw, const float pitch);
+
 	inline float GetZoom() const noexcept { return m_zoom; }
 	inline const glm::vec3& GetPosition() const noexcept { return m_position; }
 	inline const glm::vec3& GetFront() const noexcept { return m_front; }
+	inline float GetYaw() const noexcept { return m_yaw; }
+	inline float GetPitch() const noexcept { return m_pitch; }
 	inline glm::mat4 GetViewMatrix() const noexcept { return glm::lookAtLH(m_position, m_position + m_front, m_up); }
 
 private:
@@ -0,0 +1,257 @@
+#include "CameraPath.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+
+[[nodiscard]] CameraPath CameraPath::CreateStandardRoute()
+{
+	CameraPath standardRoute;
+
+	// Cruises at walking speed through the spawn area, then flies at sprint speed (roughly 200 units/s) across dozens of chunk borders along both axes.
+	standardRoute.AddKeyframe(Keyframe{ 0.0f, glm::vec3{ 0.0f, 80.0f, 0.0f }, 90.0f, 0.0f });
+	standardRoute.AddKeyframe(Keyframe{ 5.0f, glm::vec3{ 0.0f, 90.0f, 200.0f }, 90.0f, -10.0f });
+	standardRoute.AddKeyframe(Keyframe{ 10.0f, glm::vec3{ 150.0f, 100.0f, 400.0f }, 45.0f, -5.0f });
+	standardRoute.AddKeyframe(Keyframe{ 15.0f, glm::vec3{ 400.0f, 110.0f, 500.0f }, 0.0f, -15.0f });
+	standardRoute.AddKeyframe(Keyframe{ 25.0f, glm::vec3{ 2400.0f, 120.0f, 500.0f }, 0.0f, -15.0f });
+	standardRoute.AddKeyframe(Keyframe{ 30.0f, glm::vec3{ 2600.0f, 140.0f, 800.0f }, 90.0f, -20.0f });
+	standardRoute.AddKeyframe(Keyframe{ 40.0f, glm::vec3{ 2600.0f, 120.0f, 2800.0f }, 90.0f, -20.0f });
+	standardRoute.AddKeyframe(Keyframe{ 45.0f, glm::vec3{ 2300.0f, 100.0f, 3000.0f }, 180.0f, -10.0f });
+	standardRoute.AddKeyframe(Keyframe{ 50.0f, glm::vec3{ 2000.0f, 90.0f, 3000.0f }, 180.0f, 0.0f });
+
+	return standardRoute;
+}
+
+CameraPath::CameraPath(const std::string& filepath)
+{
+	Load(filepath);
+}
+
+void CameraPath::Save(const std::string& filepath) const
+{
+	std::ofstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open camera path file " + filepath + " for writing.");
+	}
+
+	file.precision(9);
+	file << s_FileHeader << " " << s_FileVersion << "\n";
+
+	for (const auto& keyframe : m_keyframes)
+	{
+		file << "keyframe " << keyframe.time << " " << keyframe.position.x << " " << keyframe.position.y << " " << keyframe.position.z << " " << keyframe.yaw << " " << keyframe.pitch << "\n";
+	}
+
+	for (const auto& inputFrame : m_inputFrames)
+	{
+		const Camera3D::InputState& input = inputFrame.input;
+
+		file << "input " << inputFrame.deltaTime << " "
+			<< input.moveForward << " " << input.moveBackward << " " << input.moveLeft << " " << input.moveRight << " " << input.isSprinting << " "
+			<< input.mouseDelta.x << " " << input.mouseDelta.y << "\n";
+	}
+
+	if (!file.good())
+	{
+		throw std::runtime_error("Failed to write camera path file " + filepath + ".");
+	}
+}
+
+void CameraPath::AddKeyframe(const Keyframe& keyframe)
+{
+	if (!m_inputFrames.empty())
+	{
+		throw std::invalid_argument("Cannot mix keyframes and recorded input in one camera path.");
+	}
+
+	if (!m_keyframes.empty() && keyframe.time <= m_keyframes.back().time)
+	{
+		throw std::invalid_argument("Camera path keyframes must be in strictly increasing time order.");
+	}
+
+	m_keyframes.push_back(keyframe);
+}
+
+void CameraPath::AddInputFrame(const InputFrame& inputFrame)
+{
+	if (!m_keyframes.empty())
+	{
+		throw std::invalid_argument("Cannot mix keyframes and recorded input in one camera path.");
+	}
+
+	m_inputFrames.push_back(inputFrame);
+}
+
+[[nodiscard]] float CameraPath::Apply(Camera3D& camera, const std::uint32_t frameIndex, const float timestep) const
+{
+	if (IsInputRecording())
+	{
+		if (frameIndex >= m_inputFrames.size())
+		{
+			camera.ApplyInput(Camera3D::InputState{ });
+
+			return timestep;
+		}
+
+		camera.ApplyInput(m_inputFrames[frameIndex].input);
+
+		return m_inputFrames[frameIndex].deltaTime;
+	}
+
+	if (!m_keyframes.empty())
+	{
+		const Keyframe pose = Evaluate(static_cast<float>(frameIndex) * timestep);
+		camera.SetPose(pose.position, pose.yaw, pose.pitch);
+	}
+
+	return timestep;
+}
+
+[[nodiscard]] CameraPath::Keyframe CameraPath::Evaluate(const float time) const
+{
+	if (m_keyframes.empty())
+	{
+		throw std::logic_error("Cannot evaluate a camera path without keyframes.");
+	}
+
+	if (time <= m_keyframes.front().time)
+	{
+		return m_keyframes.front();
+	}
+
+	if (time >= m_keyframes.back().time)
+	{
+		return m_keyframes.back();
+	}
+
+	const auto nextKeyframe = std::upper_bound(std::cbegin(m_keyframes), std::cend(m_keyframes), time, [](const float sampleTime, const Keyframe& keyframe)
+	{
+		return sampleTime < keyframe.time;
+	});
+
+	const std::size_t nextIndex = static_cast<std::size_t>(std::distance(std::cbegin(m_keyframes), nextKeyframe));
+	const std::size_t currentIndex = nextIndex - 1u;
+
+	const Keyframe& k0 = m_keyframes[currentIndex == 0u ? 0u : currentIndex - 1u];
+	const Keyframe& k1 = m_keyframes[currentIndex];
+	const Keyframe& k2 = m_keyframes[nextIndex];
+	const Keyframe& k3 = m_keyframes[std::min(nextIndex + 1u, m_keyframes.size() - 1u)];
+
+	const float t = (time - k1.time) / (k2.time - k1.time);
+
+	return Keyframe{
+		.time = time,
+		.position = glm::vec3{
+			CatmullRom(k0.position.x, k1.position.x, k2.position.x, k3.position.x, t),
+			CatmullRom(k0.position.y, k1.position.y, k2.position.y, k3.position.y, t),
+			CatmullRom(k0.position.z, k1.position.z, k2.position.z, k3.position.z, t)
+		},
+		.yaw = CatmullRom(k0.yaw, k1.yaw, k2.yaw, k3.yaw, t),
+		.pitch = std::clamp(CatmullRom(k0.pitch, k1.pitch, k2.pitch, k3.pitch, t), -89.5f, 89.5f)
+	};
+}
+
+[[nodiscard]] float CameraPath::GetDuration() const noexcept
+{
+	if (IsInputRecording())
+	{
+		float duration = 0.0f;
+
+		for (const auto& inputFrame : m_inputFrames)
+		{
+			duration += inputFrame.deltaTime;
+		}
+
+		return duration;
+	}
+
+	return m_keyframes.empty() ? 0.0f : m_keyframes.back().time;
+}
+
+[[nodiscard]] std::uint32_t CameraPath::GetFrameCount(const float timestep) const noexcept
+{
+	if (IsInputRecording())
+	{
+		return static_cast<std::uint32_t>(m_inputFrames.size());
+	}
+
+	if (m_keyframes.empty() || timestep <= 0.0f)
+	{
+		return 0u;
+	}
+
+	return static_cast<std::uint32_t>(std::ceil(GetDuration() / timestep)) + 1u;
+}
+
+[[nodiscard]] float CameraPath::CatmullRom(const float p0, const float p1, const float p2, const float p3, const float t) noexcept
+{
+	const float t2 = t * t;
+	const float t3 = t2 * t;
+
+	return 0.5f * ((2.0f * p1) + (-p0 + p2) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 + (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3);
+}
+
+void CameraPath::Load(const std::string& filepath)
+{
+	std::ifstream file(filepath);
+
+	if (!file.is_open())
+	{
+		throw std::runtime_error("Failed to open camera path file " + filepath + ".");
+	}
+
+	std::string header;
+	std::uint32_t version = 0u;
+	file >> header >> version;
+
+	if (header != s_FileHeader || version != s_FileVersion)
+	{
+		throw std::runtime_error("Camera path file " + filepath + " has an invalid header.");
+	}
+
+	std::string line;
+
+	while (std::getline(file, line))
+	{
+		std::istringstream lineStream(line);
+		std::string entryType;
+
+		if (!(lineStream >> entryType))
+		{
+			continue;
+		}
+
+		if (entryType == "keyframe")
+		{
+			Keyframe keyframe{ };
+
+			if (!(lineStream >> keyframe.time >> keyframe.position.x >> keyframe.position.y >> keyframe.position.z >> keyframe.yaw >> keyframe.pitch))
+			{
+				throw std::runtime_error("Camera path file " + filepath + " contains a malformed keyframe.");
+			}
+
+			AddKeyframe(keyframe);
+		}
+		else if (entryType == "input")
+		{
+			InputFrame inputFrame{ };
+			Camera3D::InputState& input = inputFrame.input;
+
+			if (!(lineStream >> inputFrame.deltaTime >> input.moveForward >> input.moveBackward >> input.moveLeft >> input.moveRight >> input.isSprinting >> input.mouseDelta.x >> input.mouseDelta.y))
+			{
+				throw std::runtime_error("Camera path file " + filepath + " contains a malformed input frame.");
+			}
+
+			AddInputFrame(inputFrame);
+		}
+		else
+		{
+			throw std::runtime_error("Camera path file " + filepath + " contains an unknown entry type \"" + entryType + "\".");
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include "Camera3D.h"
+
+class CameraPath
+{
+public:
+	struct Keyframe
+	{
+		float time = 0.0f;
+
+		glm::vec3 position{ 0.0f, 0.0f, 0.0f };
+		float yaw = 0.0f;
+		float pitch = 0.0f;
+	};
+
+	struct InputFrame
+	{
+		float deltaTime = 0.0f;
+		Camera3D::InputState input{ };
+	};
+
+private:
+	static constexpr const char* s_FileHeader = "camera_path";
+	static constexpr std::uint32_t s_FileVersion = 1u;
+
+	std::vector<Keyframe> m_keyframes;
+	std::vector<InputFrame> m_inputFrames;
+
+public:
+	[[nodiscard]] static CameraPath CreateStandardRoute();
+
+	CameraPath() = default;
+	explicit CameraPath(const std::string& filepath);
+	~CameraPath() noexcept = default;
+
+	void Save(const std::string& filepath) const;
+
+	void AddKeyframe(const Keyframe& keyframe);
+	void AddInputFrame(const InputFrame& inputFrame);
+
+	[[nodiscard]] float Apply(Camera3D& camera, const std::uint32_t frameIndex, const float timestep) const;
+	[[nodiscard]] Keyframe Evaluate(const float time) const;
+
+	[[nodiscard]] float GetDuration() const noexcept;
+	[[nodiscard]] std::uint32_t GetFrameCount(const float timestep) const noexcept;
+
+	inline bool IsEmpty() const noexcept { return m_keyframes.empty() && m_inputFrames.empty(); }
+	inline bool IsInputRecording() const noexcept { return !m_inputFrames.empty(); }
+
+private:
+	[[nodiscard]] static float CatmullRom(const float p0, const float p1, const float p2, const float p3, const float t) noexcept;
+
+	void Load(const std::string& filepath);
+};
\ No newline at end of file
@@ -1,185 +1,148 @@
 #include "Chunk.h"
 
+#include <algorithm>
 #include <cstdint>
-#include <utility>
-#include <vector>
+#include <limits>
 
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/noise.hpp>
 
+#include "../engine/graphics/mesh/MeshletBuilder.h"
 #include "../engine/graphics/renderer/Renderer.h"
-#include "../engine/graphics/Vertex.h"
+#include "../engine/utility/Profiler.h"
 
-Chunk::Chunk(const Renderer& renderer, const glm::ivec2& position)
-	: m_vertexBuffer(renderer), m_indexBuffer(renderer), m_position(position)
+Chunk::Chunk(const Renderer& renderer, const glm::ivec2& position, const MeshType meshType)
+	: m_vertexBuffer(renderer), m_indexBuffer(renderer), m_indirectBuffer(renderer), m_position(position), m_meshType(meshType)
 {
 	m_model = glm::translate(glm::mat4{ 1.0f }, glm::vec3{ m_position.x * static_cast<int>(s_ChunkLength), 0.0f, m_position.y * static_cast<int>(s_ChunkWidth) });
 	InitialiseVertices();
+
+	if (m_indexBuffer.GetIndexCount() > 0)
+	{
+		renderer.RecordStatistic(FrameStatistics::Statistic::ChunksUploaded);
+	}
 }
 
 Chunk::~Chunk() noexcept
 { }
 
-void Chunk::Render(class Renderer& renderer, const GraphicsPipeline& pipeline)
+[[nodiscard]] bool Chunk::UpdateDrawCommands(const Renderer& renderer, const Frustum& frustum, const glm::vec3& cameraPosition)
 {
-	renderer.PushConstants(pipeline, m_model);
-
-	renderer.BindVertexBuffer(m_vertexBuffer);
-	renderer.BindIndexBuffer(m_indexBuffer);
-
-	renderer.DrawIndexed(m_indexBuffer.GetIndexCount());
-}
+	if (m_indexBuffer.GetIndexCount() == 0)
+	{
+		return false;
+	}
 
-std::vector<std::vector<float>> Chunk::CreateNoiseMap(const glm::ivec2& position)
-{
-	std::vector<std::vector<float>> noiseMap(s_ChunkLength + 1, std::vector<float>(s_ChunkWidth + 1));
+	const std::uint32_t frameIndex = renderer.GetCurrentFrameIndex();
+	const glm::vec3 chunkOrigin{ m_model[3] };
+	std::uint64_t visibleIndexCount = 0u;
+	std::uint64_t visibleTriangleCount = 0u;
 
-	for (int x = 0; x < noiseMap.size(); ++x)
+	if (frustum.ContainsSphere(chunkOrigin + m_boundingSphereCentre, m_boundingSphereRadius))
 	{
-		for (int z = 0; z < noiseMap.front().size(); ++z)
+		VkDrawIndexedIndirectCommand* const drawCommands = m_indirectBuffer.GetRegionCommands(frameIndex);
+
+		if (m_meshlets.empty())
 		{
-			constexpr auto NormalisedSimplex = [](const glm::vec2& values) -> float
+			drawCommands[0] = VkDrawIndexedIndirectCommand{ m_indexBuffer.GetIndexCount(), 1u, 0, 0, m_instanceIndex };
+			visibleIndexCount = m_indexBuffer.GetIndexCount();
+			visibleTriangleCount = m_triangleCount;
+		}
+		else
+		{
+			const glm::vec3 localCameraPosition = cameraPosition - chunkOrigin;
+
+			for (std::size_t i = 0; i < m_meshlets.size(); ++i)
 			{
-				return (glm::simplex(glm::vec2{ values.x, values.y }) + 1.0f) / 2.0f;
-			};
+				const Meshlet& meshlet = m_meshlets[i];
+				const bool isVisible = !MeshletBuilder::IsBackFacing(meshlet, localCameraPosition) && frustum.ContainsSphere(chunkOrigin + meshlet.boundingSphereCentre, meshlet.boundingSphereRadius);
 
-			const float normalisedX = ((position.x * static_cast<int>(s_ChunkLength)) + x) / (16.0f * s_ChunkLength) - 0.5f;
-			const float normalisedZ = ((position.y * static_cast<int>(s_ChunkWidth)) + z) / (16.0f * s_ChunkWidth) - 0.5f;
+				drawCommands[i] = VkDrawIndexedIndirectCommand{ meshlet.indexCount, isVisible ? 1u : 0u, meshlet.firstIndex, 0, m_instanceIndex };
 
-			noiseMap[x][z] = NormalisedSimplex(1.0f * glm::vec2{ normalisedX, normalisedZ });
-			noiseMap[x][z] += 0.5f * NormalisedSimplex(2.0f * glm::vec2{ normalisedX, normalisedZ });
-			noiseMap[x][z] += 0.25f * NormalisedSimplex(4.0f * glm::vec2{ normalisedX, normalisedZ });
-			noiseMap[x][z] += 0.125f * NormalisedSimplex(8.0f * glm::vec2{ normalisedX, normalisedZ });
-			noiseMap[x][z] += 0.0625f * NormalisedSimplex(16.0f * glm::vec2{ normalisedX, normalisedZ });
-			noiseMap[x][z] = glm::pow(noiseMap[x][z], 2);
+				if (isVisible)
+				{
+					visibleIndexCount += meshlet.indexCount;
+					visibleTriangleCount += meshlet.triangleCount;
+				}
+			}
+		}
 
-			noiseMap[x][z] *= 64.0f;
+		if (visibleIndexCount > 0u)
+		{
+			m_indirectBuffer.FlushRegion(frameIndex);
 		}
 	}
 
-	return noiseMap;
-}
+	renderer.RecordStatistic(FrameStatistics::Statistic::TrianglesSubmitted, visibleTriangleCount);
 
-void Chunk::InitialiseVertices()
-{
-	const auto noiseMap = CreateNoiseMap(m_position);
+	const std::uint32_t frameMask = 1u << frameIndex;
+	const bool wasVisible = (m_visibleFrameMask & frameMask) != 0u;
+	const bool isVisible = visibleIndexCount > 0u;
 
-	std::vector<VertexP3C3N3> chunkVertices;
-	chunkVertices.reserve(s_ChunkLength * s_ChunkWidth * 4);
+	m_visibleFrameMask = isVisible ? m_visibleFrameMask | frameMask : m_visibleFrameMask & ~frameMask;
 
-	std::vector<std::uint16_t> chunkIndices;
-	chunkIndices.reserve(s_ChunkLength * s_ChunkWidth * 6);
+	return isVisible != wasVisible;
+}
 
-	unsigned int indexCount = 0;
+void Chunk::Render(class Renderer& renderer, const GraphicsPipeline& pipeline) const
+{
+	if (m_indexBuffer.GetIndexCount() == 0 || (m_visibleFrameMask & (1u << renderer.GetCurrentFrameIndex())) == 0u)
+	{
+		return;
+	}
 
-	for (std::size_t x = 0; x < s_ChunkLength; ++x)
+	if (m_instanceIndex == 0u)
 	{
-		for (std::size_t z = 0; z < s_ChunkWidth; ++z)
-		{
-			const std::pair<glm::vec3, glm::vec3> triangleA{
-				glm::vec3{ 1.0f + x, noiseMap[x + 1][z], z } - glm::vec3{ x, noiseMap[x][z], z },
-				glm::vec3{ x, noiseMap[x][z + 1], 1.0f + z } - glm::vec3{ x, noiseMap[x][z], z }
-			};
-
-			const std::pair<glm::vec3, glm::vec3> triangleB{
-				glm::vec3{ 1.0f + x, noiseMap[x + 1][z], z } - glm::vec3{ x, noiseMap[x][z + 1], 1.0f + z },
-				glm::vec3{ 1.0f + x, noiseMap[x + 1][z + 1], 1.0f + z } - glm::vec3{ x, noiseMap[x][z + 1], 1.0f + z }
-			};
-
-			chunkVertices.push_back({
-				glm::vec3{ x, noiseMap[x][z], z },
-				GetBiomeColour(noiseMap[x][z]),
-				glm::normalize(-glm::cross(triangleA.first, triangleA.second))
-			});
-
-			chunkVertices.push_back({
-				glm::vec3{ 1.0f + x, noiseMap[x + 1][z], z },
-				GetBiomeColour(noiseMap[x][z]),
-				glm::normalize(-glm::cross(triangleA.first, triangleA.second))
-			});
-
-			chunkVertices.push_back({
-				glm::vec3{ x, noiseMap[x][z + 1], 1.0f + z },
-				GetBiomeColour(noiseMap[x][z]),
-				glm::normalize(-glm::cross(triangleA.first, triangleA.second))
-			});
-
-			chunkVertices.push_back({
-				glm::vec3{ 1.0f + x, noiseMap[x + 1][z + 1], 1.0f + z },
-				GetBiomeColour(noiseMap[x][z]),
-				glm::normalize(-glm::cross(triangleB.first, triangleB.second))
-			});
-
-			chunkIndices.push_back(indexCount + 0);
-			chunkIndices.push_back(indexCount + 1);
-			chunkIndices.push_back(indexCount + 2);
-			chunkIndices.push_back(indexCount + 2);
-			chunkIndices.push_back(indexCount + 1);
-			chunkIndices.push_back(indexCount + 3);
-
-			indexCount += 4;
-		}
+		renderer.PushConstants(pipeline, m_model);
 	}
 
-	m_vertexBuffer.Initialise(chunkVertices);
-	m_indexBuffer.Initialise(chunkIndices);
+	renderer.BindVertexBuffer(m_vertexBuffer);
+	renderer.BindIndexBuffer(m_indexBuffer);
+
+	renderer.DrawIndexedIndirect(m_indirectBuffer, renderer.GetCurrentFrameIndex());
 }
 
-glm::vec3 Chunk::GetBiomeColour(const float height) const
+void Chunk::InitialiseVertices()
 {
-	if (height < 16)
-	{
-		// Deep water
-		return glm::vec3{ 0.0f, 0.2f, 0.8f };
-	}
-	else if (height < 24)
-	{
-		// Water
-		return glm::vec3{ 0.0f, 0.5f, 1.0f };
-	}
-	else if (height < 28)
-	{
-		// Sand
-		return glm::vec3{ 1.0f, 1.0f, 0.5f };
-	}
-	else if (height < 40)
-	{
-		// Grass
-		return glm::vec3{ 0.2f, 0.8f, 0.1f };
-	}
-	else if (height < 44)
-	{
-		// Highlands grass
-		return glm::vec3{ 0.2f, 0.6f, 0.1f };
-	}
-	else if (height < 54)
-	{
-		// Mountainous grass
-		return glm::vec3{ 0.2f, 0.5f, 0.1f };
-	}
-	else if (height < 64)
-	{
-		// Mountain-grass connection
-		return glm::vec3{ 0.3f, 0.3f, 0.1f };
-	}
-	else if (height < 80)
-	{
-		// Mountain
-		return glm::vec3{ 0.4f, 0.2f, 0.1f };
-	}
-	else if (height < 96)
+	PROFILE_SCOPE("Chunk::InitialiseVertices");
+
+	const MeshData mesh = CreateMesh(CreateNoiseMap(m_position), m_meshType);
+
+	if (mesh.indices.empty())
 	{
-		// High mountain
-		return glm::vec3{ 0.6f, 0.4f, 0.3f };
+		return;
 	}
-	else if (height < 104)
+
+	m_vertexBuffer.Initialise(mesh.vertices);
+	m_indexBuffer.Initialise(mesh.indices);
+
+	InitialiseBounds(mesh);
+
+	m_triangleCount = m_meshType == MeshType::GridStrip
+		? FrameStatistics::GetTriangleCount(GetPrimitiveTopology(m_meshType), mesh.indices, s_PrimitiveRestartIndex)
+		: FrameStatistics::GetTriangleCount(GetPrimitiveTopology(m_meshType), mesh.indices);
+
+	if (GetPrimitiveTopology(m_meshType) == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST)
 	{
-		// Very high mountain
-		return glm::vec3{ 1.0f, 0.8f, 0.7f };
+		m_meshlets = MeshletBuilder::Build(mesh.vertices, mesh.indices).meshlets;
 	}
-	else
+
+	m_indirectBuffer.Initialise(std::max(static_cast<std::uint32_t>(m_meshlets.size()), 1u), Renderer::GetMaxFramesInFlight());
+
+	m_deviceBytes = mesh.vertices.size() * sizeof(VertexP3C3N3) + mesh.indices.size() * sizeof(std::uint16_t)
+		+ static_cast<std::uint64_t>(m_indirectBuffer.GetCommandCount()) * m_indirectBuffer.GetRegionCount() * sizeof(VkDrawIndexedIndirectCommand);
+}
+
+void Chunk::InitialiseBounds(const MeshData& mesh)
+{
+	glm::vec3 minExtent{ std::numeric_limits<float>::max() };
+	glm::vec3 maxExtent{ std::numeric_limits<float>::lowest() };
+
+	for (const auto& vertex : mesh.vertices)
 	{
-		// Snow cap
-		return glm::vec3{ 1.0f, 1.0f, 1.0f };
+		minExtent = glm::min(minExtent, vertex.position);
+		maxExtent = glm::max(maxExtent, vertex.position);
 	}
+
+	m_boundingSphereCentre = (minExtent + maxExtent) / 2.0f;
+	m_boundingSphereRadius = glm::length(maxExtent - minExtent) / 2.0f;
 }
\ No newline at end of file
@@ -1,39 +1,112 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
 
 #include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
 
 #include "../engine/graphics/buffers/IndexBuffer.h"
+#include "../engine/graphics/buffers/IndirectBuffer.h"
 #include "../engine/graphics/buffers/VertexBuffer.h"
+#include "../engine/graphics/mesh/Meshlet.h"
 #include "../engine/graphics/pipeline/GraphicsPipeline.h"
+#include "../engine/graphics/Frustum.h"
+#include "../engine/graphics/Vertex.h"
+#include "../engine/utility/MemoryTracker.h"
 
 class Chunk
 {
+public:
+	enum class MeshType
+	{
+		Grid,
+		GridStrip,
+		RTIN
+	};
+
+	using HeightMap = TrackedVector<TrackedVector<float, MemoryTracker::Category::HeightMaps>, MemoryTracker::Category::HeightMaps>;
+
+	struct MeshData
+	{
+		TrackedVector<VertexP3C3N3, MemoryTracker::Category::MeshVertices> vertices;
+		TrackedVector<std::uint16_t, MemoryTracker::Category::MeshIndices> indices;
+	};
+
+	struct NoiseSettings
+	{
+		std::size_t length = s_ChunkLength;
+		std::size_t width = s_ChunkWidth;
+		std::uint32_t octaveCount = s_DefaultOctaveCount;
+	};
+
 private:
 	static constexpr std::size_t s_ChunkLength = 32u;
 	static constexpr std::size_t s_ChunkWidth = 32u;
+	static constexpr std::uint32_t s_DefaultOctaveCount = 5u;
+
+	static constexpr float s_WaterLevel = 24.0f;
+	static constexpr float s_SeabedHeight = s_WaterLevel - 1.0f;
+
+	static constexpr float s_DefaultMaxRTINError = 1.0f;
+	static constexpr std::uint16_t s_PrimitiveRestartIndex = std::numeric_limits<std::uint16_t>::max();
 
 	VertexBuffer m_vertexBuffer;
 	IndexBuffer m_indexBuffer;
+	IndirectBuffer m_indirectBuffer;
+
+	std::vector<Meshlet> m_meshlets;
+	glm::vec3 m_boundingSphereCentre{ 0.0f, 0.0f, 0.0f };
+	float m_boundingSphereRadius = 0.0f;
+	std::uint64_t m_triangleCount = 0u;
+	std::uint64_t m_deviceBytes = 0u;
+	std::uint32_t m_visibleFrameMask = 0u;
+	std::uint32_t m_instanceIndex = 0u;
 
 	glm::ivec2 m_position;
 	glm::mat4 m_model{ 1.0f };
 
+	MeshType m_meshType;
+
 public:
 	static constexpr std::size_t GetChunkLength() noexcept { return s_ChunkLength; }
 	static constexpr std::size_t GetChunkWidth() noexcept { return s_ChunkWidth; }
-	
-	Chunk(const class Renderer& renderer, const glm::ivec2& position);
+	static constexpr std::uint32_t GetDefaultOctaveCount() noexcept { return s_DefaultOctaveCount; }
+	static constexpr float GetWaterLevel() noexcept { return s_WaterLevel; }
+	static constexpr float GetDefaultMaxRTINError() noexcept { return s_DefaultMaxRTINError; }
+	static constexpr std::uint16_t GetPrimitiveRestartIndex() noexcept { return s_PrimitiveRestartIndex; }
+
+	[[nodiscard]] static HeightMap CreateNoiseMap(const glm::ivec2& position);
+	[[nodiscard]] static HeightMap CreateNoiseMap(const glm::ivec2& position, const NoiseSettings& noiseSettings);
+	[[nodiscard]] static MeshData CreateMesh(const HeightMap& noiseMap, const MeshType meshType);
+	[[nodiscard]] static MeshData CreateGridMesh(const HeightMap& noiseMap);
+	[[nodiscard]] static MeshData CreateGridStripMesh(const HeightMap& noiseMap);
+	[[nodiscard]] static MeshData CreateRTINMesh(const HeightMap& noiseMap, const float maxError = s_DefaultMaxRTINError);
+	[[nodiscard]] static glm::vec3 GetBiomeColour(const float height);
+	[[nodiscard]] static glm::vec3 CalculateTriangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c);
+	[[nodiscard]] static VkPrimitiveTopology GetPrimitiveTopology(const MeshType meshType);
+
+	Chunk(const class Renderer& renderer, const glm::ivec2& position, const MeshType meshType = MeshType::Grid);
 	~Chunk() noexcept;
 
-	void Render(class Renderer& renderer, const GraphicsPipeline& pipeline);
+	[[nodiscard]] bool UpdateDrawCommands(const class Renderer& renderer, const Frustum& frustum, const glm::vec3& cameraPosition);
+	void Render(class Renderer& renderer, const GraphicsPipeline& pipeline) const;
 
 	inline const glm::ivec2& GetPosition() const noexcept { return m_position; }
+	inline MeshType GetMeshType() const noexcept { return m_meshType; }
+	inline std::uint64_t GetDeviceBytes() const noexcept { return m_deviceBytes; }
+	inline const std::vector<Meshlet>& GetMeshlets() const noexcept { return m_meshlets; }
+	inline void SetInstanceIndex(const std::uint32_t instanceIndex) noexcept { m_instanceIndex = instanceIndex; }
+	inline std::uint32_t GetInstanceIndex() const noexcept { return m_instanceIndex; }
+
+	inline VertexBuffer& GetVertexBuffer() noexcept { return m_vertexBuffer; }
+	inline IndexBuffer& GetIndexBuffer() noexcept { return m_indexBuffer; }
 
 private:
-	static std::vector<std::vector<float>> CreateNoiseMap(const glm::ivec2& position);
+	[[nodiscard]] static bool IsSubmerged(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c);
 
 	void InitialiseVertices();
-	glm::vec3 GetBiomeColour(const float height) const;
+	void InitialiseBounds(const MeshData& mesh);
 };
\ No newline at end of file
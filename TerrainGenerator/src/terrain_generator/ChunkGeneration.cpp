@@ -0,0 +1,361 @@
+#include "Chunk.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <glm/gtc/noise.hpp>
+
+#include "../engine/graphics/mesh/VertexCacheOptimiser.h"
+#include "../engine/utility/Profiler.h"
+#include "RTINMesher.h"
+
+[[nodiscard]] Chunk::HeightMap Chunk::CreateNoiseMap(const glm::ivec2& position)
+{
+	return CreateNoiseMap(position, NoiseSettings{ });
+}
+
+[[nodiscard]] Chunk::HeightMap Chunk::CreateNoiseMap(const glm::ivec2& position, const NoiseSettings& noiseSettings)
+{
+	PROFILE_SCOPE("Chunk::CreateNoiseMap");
+
+	HeightMap noiseMap(noiseSettings.length + 1, HeightMap::value_type(noiseSettings.width + 1));
+
+	for (int x = 0; x < noiseMap.size(); ++x)
+	{
+		for (int z = 0; z < noiseMap.front().size(); ++z)
+		{
+			constexpr auto NormalisedSimplex = [](const glm::vec2& values) -> float
+			{
+				return (glm::simplex(glm::vec2{ values.x, values.y }) + 1.0f) / 2.0f;
+			};
+
+			const float normalisedX = ((position.x * static_cast<int>(noiseSettings.length)) + x) / (16.0f * noiseSettings.length) - 0.5f;
+			const float normalisedZ = ((position.y * static_cast<int>(noiseSettings.width)) + z) / (16.0f * noiseSettings.width) - 0.5f;
+
+			float amplitude = 1.0f;
+			float frequency = 1.0f;
+			noiseMap[x][z] = 0.0f;
+
+			for (std::uint32_t octave = 0; octave < noiseSettings.octaveCount; ++octave)
+			{
+				noiseMap[x][z] += amplitude * NormalisedSimplex(frequency * glm::vec2{ normalisedX, normalisedZ });
+
+				amplitude *= 0.5f;
+				frequency *= 2.0f;
+			}
+
+			noiseMap[x][z] = glm::pow(noiseMap[x][z], 2);
+
+			noiseMap[x][z] *= 64.0f;
+			noiseMap[x][z] = glm::max(noiseMap[x][z], s_SeabedHeight);
+		}
+	}
+
+	return noiseMap;
+}
+
+[[nodiscard]] Chunk::MeshData Chunk::CreateMesh(const HeightMap& noiseMap, const MeshType meshType)
+{
+	MeshData mesh{ };
+
+	switch (meshType)
+	{
+	case MeshType::RTIN:
+		mesh = CreateRTINMesh(noiseMap);
+		VertexCacheOptimiser::Optimise(mesh.indices, mesh.vertices.size());
+
+		break;
+
+	case MeshType::GridStrip:
+		mesh = CreateGridStripMesh(noiseMap);
+
+		break;
+
+	case MeshType::Grid:
+	default:
+		mesh = CreateGridMesh(noiseMap);
+
+		break;
+	}
+
+	return mesh;
+}
+
+[[nodiscard]] Chunk::MeshData Chunk::CreateGridMesh(const HeightMap& noiseMap)
+{
+	const std::size_t length = noiseMap.size() - 1;
+	const std::size_t width = noiseMap.front().size() - 1;
+
+	MeshData mesh{ };
+	mesh.vertices.reserve(length * width * 4);
+	mesh.indices.reserve(length * width * 6);
+
+	unsigned int indexCount = 0;
+
+	for (std::size_t x = 0; x < length; ++x)
+	{
+		for (std::size_t z = 0; z < width; ++z)
+		{
+			const glm::vec3 bottomLeft{ x, noiseMap[x][z], z };
+			const glm::vec3 bottomRight{ 1.0f + x, noiseMap[x + 1][z], z };
+			const glm::vec3 topLeft{ x, noiseMap[x][z + 1], 1.0f + z };
+			const glm::vec3 topRight{ 1.0f + x, noiseMap[x + 1][z + 1], 1.0f + z };
+
+			const bool isTriangleASubmerged = IsSubmerged(bottomLeft, bottomRight, topLeft);
+			const bool isTriangleBSubmerged = IsSubmerged(topLeft, bottomRight, topRight);
+
+			if (isTriangleASubmerged && isTriangleBSubmerged)
+			{
+				continue;
+			}
+
+			const glm::vec3 colour = GetBiomeColour(noiseMap[x][z]);
+			const glm::vec3 triangleANormal = CalculateTriangleNormal(bottomLeft, bottomRight, topLeft);
+			const glm::vec3 triangleBNormal = CalculateTriangleNormal(topLeft, bottomRight, topRight);
+
+			mesh.vertices.push_back({ bottomLeft, colour, triangleANormal });
+			mesh.vertices.push_back({ bottomRight, colour, triangleANormal });
+			mesh.vertices.push_back({ topLeft, colour, triangleANormal });
+			mesh.vertices.push_back({ topRight, colour, triangleBNormal });
+
+			if (!isTriangleASubmerged)
+			{
+				mesh.indices.push_back(indexCount + 0);
+				mesh.indices.push_back(indexCount + 1);
+				mesh.indices.push_back(indexCount + 2);
+			}
+
+			if (!isTriangleBSubmerged)
+			{
+				mesh.indices.push_back(indexCount + 2);
+				mesh.indices.push_back(indexCount + 1);
+				mesh.indices.push_back(indexCount + 3);
+			}
+
+			indexCount += 4;
+		}
+	}
+
+	return mesh;
+}
+
+[[nodiscard]] Chunk::MeshData Chunk::CreateGridStripMesh(const HeightMap& noiseMap)
+{
+	const std::size_t length = noiseMap.size() - 1;
+	const std::size_t width = noiseMap.front().size() - 1;
+	const std::size_t rowLength = width + 1;
+
+	MeshData mesh{ };
+	mesh.vertices.reserve((length + 1) * rowLength);
+	mesh.indices.reserve(length * (rowLength * 2 + 1));
+
+	for (std::size_t x = 0; x <= length; ++x)
+	{
+		for (std::size_t z = 0; z <= width; ++z)
+		{
+			const float heightDeltaX = noiseMap[std::min(x + 1, length)][z] - noiseMap[x > 0 ? x - 1 : x][z];
+			const float heightDeltaZ = noiseMap[x][std::min(z + 1, width)] - noiseMap[x][z > 0 ? z - 1 : z];
+
+			const glm::vec3 position{ x, noiseMap[x][z], z };
+			const glm::vec3 normal = glm::normalize(glm::vec3{ -heightDeltaX, 2.0f, -heightDeltaZ });
+
+			mesh.vertices.push_back({ position, GetBiomeColour(noiseMap[x][z]), normal });
+		}
+	}
+
+	for (std::size_t x = 0; x < length; ++x)
+	{
+		bool isStripOpen = false;
+
+		for (std::size_t z = 0; z < width; ++z)
+		{
+			const std::uint16_t bottomLeft = static_cast<std::uint16_t>(x * rowLength + z);
+			const std::uint16_t bottomRight = static_cast<std::uint16_t>((x + 1) * rowLength + z);
+
+			const bool isQuadSubmerged = IsSubmerged(mesh.vertices[bottomLeft].position, mesh.vertices[bottomRight].position, mesh.vertices[bottomLeft + 1].position)
+				&& IsSubmerged(mesh.vertices[bottomLeft + 1].position, mesh.vertices[bottomRight].position, mesh.vertices[bottomRight + 1].position);
+
+			if (isQuadSubmerged)
+			{
+				if (isStripOpen)
+				{
+					mesh.indices.push_back(s_PrimitiveRestartIndex);
+					isStripOpen = false;
+				}
+
+				continue;
+			}
+
+			if (!isStripOpen)
+			{
+				mesh.indices.push_back(bottomLeft);
+				mesh.indices.push_back(bottomRight);
+				isStripOpen = true;
+			}
+
+			mesh.indices.push_back(bottomLeft + 1);
+			mesh.indices.push_back(bottomRight + 1);
+		}
+
+		if (isStripOpen)
+		{
+			mesh.indices.push_back(s_PrimitiveRestartIndex);
+		}
+	}
+
+	if (std::all_of(std::cbegin(mesh.indices), std::cend(mesh.indices), [](const std::uint16_t index) { return index == s_PrimitiveRestartIndex; }))
+	{
+		mesh.indices.clear();
+	}
+
+	return mesh;
+}
+
+[[nodiscard]] Chunk::MeshData Chunk::CreateRTINMesh(const HeightMap& noiseMap, const float maxError)
+{
+	static_assert(s_ChunkLength == s_ChunkWidth, "RTIN meshing requires square chunks.");
+	static const RTINMesher rtinMesher(s_ChunkLength + 1);
+
+	if (noiseMap.size() != s_ChunkLength + 1 || noiseMap.front().size() != s_ChunkWidth + 1)
+	{
+		throw std::invalid_argument("RTIN meshing is only supported at the default chunk size.");
+	}
+
+	const RTINMesher::Mesh rtinMesh = rtinMesher.CreateMesh(rtinMesher.CreateErrorMap(noiseMap), maxError);
+
+	constexpr std::uint16_t UnusedVertex = std::numeric_limits<std::uint16_t>::max();
+
+	MeshData mesh{ };
+	mesh.vertices.reserve(rtinMesh.vertices.size());
+	mesh.indices.reserve(rtinMesh.triangles.size());
+
+	std::vector<std::uint16_t> meshVertexIndices(rtinMesh.vertices.size(), UnusedVertex);
+
+	for (std::size_t i = 0; i < rtinMesh.triangles.size(); i += 3)
+	{
+		std::array<std::uint32_t, 3u> rtinVertexIndices{ rtinMesh.triangles[i], rtinMesh.triangles[i + 1], rtinMesh.triangles[i + 2] };
+		std::array<glm::vec3, 3u> corners{ };
+
+		for (std::size_t j = 0; j < corners.size(); ++j)
+		{
+			const glm::uvec2& gridPosition = rtinMesh.vertices[rtinVertexIndices[j]];
+			corners[j] = glm::vec3{ gridPosition.x, noiseMap[gridPosition.x][gridPosition.y], gridPosition.y };
+		}
+
+		if (IsSubmerged(corners[0], corners[1], corners[2]))
+		{
+			continue;
+		}
+
+		const glm::vec3 firstEdge = corners[1] - corners[0];
+		const glm::vec3 secondEdge = corners[2] - corners[0];
+
+		if (firstEdge.z * secondEdge.x - firstEdge.x * secondEdge.z > 0.0f)
+		{
+			std::swap(corners[1], corners[2]);
+			std::swap(rtinVertexIndices[1], rtinVertexIndices[2]);
+		}
+
+		const glm::vec3 normal = CalculateTriangleNormal(corners[0], corners[1], corners[2]);
+
+		for (std::size_t j = 0; j < corners.size(); ++j)
+		{
+			std::uint16_t& meshVertexIndex = meshVertexIndices[rtinVertexIndices[j]];
+
+			if (meshVertexIndex == UnusedVertex)
+			{
+				meshVertexIndex = static_cast<std::uint16_t>(mesh.vertices.size());
+				mesh.vertices.push_back({ corners[j], GetBiomeColour(corners[j].y), glm::vec3{ 0.0f } });
+			}
+
+			mesh.vertices[meshVertexIndex].normal += normal;
+			mesh.indices.push_back(meshVertexIndex);
+		}
+	}
+
+	for (auto& vertex : mesh.vertices)
+	{
+		vertex.normal = glm::normalize(vertex.normal);
+	}
+
+	return mesh;
+}
+
+[[nodiscard]] glm::vec3 Chunk::GetBiomeColour(const float height)
+{
+	if (height < 16)
+	{
+		// Deep water
+		return glm::vec3{ 0.0f, 0.2f, 0.8f };
+	}
+	else if (height < 24)
+	{
+		// Water
+		return glm::vec3{ 0.0f, 0.5f, 1.0f };
+	}
+	else if (height < 28)
+	{
+		// Sand
+		return glm::vec3{ 1.0f, 1.0f, 0.5f };
+	}
+	else if (height < 40)
+	{
+		// Grass
+		return glm::vec3{ 0.2f, 0.8f, 0.1f };
+	}
+	else if (height < 44)
+	{
+		// Highlands grass
+		return glm::vec3{ 0.2f, 0.6f, 0.1f };
+	}
+	else if (height < 54)
+	{
+		// Mountainous grass
+		return glm::vec3{ 0.2f, 0.5f, 0.1f };
+	}
+	else if (height < 64)
+	{
+		// Mountain-grass connection
+		return glm::vec3{ 0.3f, 0.3f, 0.1f };
+	}
+	else if (height < 80)
+	{
+		// Mountain
+		return glm::vec3{ 0.4f, 0.2f, 0.1f };
+	}
+	else if (height < 96)
+	{
+		// High mountain
+		return glm::vec3{ 0.6f, 0.4f, 0.3f };
+	}
+	else if (height < 104)
+	{
+		// Very high mountain
+		return glm::vec3{ 1.0f, 0.8f, 0.7f };
+	}
+	else
+	{
+		// Snow cap
+		return glm::vec3{ 1.0f, 1.0f, 1.0f };
+	}
+}
+
+[[nodiscard]] VkPrimitiveTopology Chunk::GetPrimitiveTopology(const MeshType meshType)
+{
+	return meshType == MeshType::GridStrip ? VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+}
+
+[[nodiscard]] glm::vec3 Chunk::CalculateTriangleNormal(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+	return glm::normalize(-glm::cross(b - a, c - a));
+}
+
+[[nodiscard]] bool Chunk::IsSubmerged(const glm::vec3& a, const glm::vec3& b, const glm::vec3& c)
+{
+	return a.y < s_WaterLevel && b.y < s_WaterLevel && c.y < s_WaterLevel;
+}
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "HeadlessTerrainGenerator.h"
+
+#include <chrono>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+#include "../engine/utility/FrameTimeReport.h"
+#include "../engine/utility/MemoryTracker.h"
+#include "../engine/utility/Profiler.h"
+
+HeadlessTerrainGenerator::HeadlessTerrainGenerator(const Config& config)
+	: m_config(config)
+{
+	Initialise();
+}
+
+HeadlessTerrainGenerator::~HeadlessTerrainGenerator() noexcept
+{
+	Destroy();
+}
+
+void HeadlessTerrainGenerator::Run()
+{
+	const std::uint32_t frameCount = m_config.frameCount.value_or(m_cameraPath.GetFrameCount(m_config.timestep));
+
+	std::vector<double> frameTimes;
+	frameTimes.reserve(frameCount);
+
+	for (std::uint32_t frame = 0; frame < frameCount; ++frame)
+	{
+		PROFILE_SCOPE("HeadlessTerrainGenerator::Frame");
+		const auto frameStartTime = std::chrono::steady_clock::now();
+
+		const float deltaTime = m_cameraPath.Apply(m_world->GetCamera(), frame, m_config.timestep);
+		m_world->Update(deltaTime);
+		Render();
+
+		frameTimes.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStartTime).count());
+	}
+
+	m_renderer->FinaliseRenderOperations();
+	PROFILE_WRITE_TRACE(Profiler::GetDefaultTraceFilepath());
+
+	const FrameTimeReport frameTimeReport(std::move(frameTimes));
+
+	std::cout << "Rendered " << frameCount << " headless frames at " << m_config.size.x << "x" << m_config.size.y << " along " << m_cameraPath.GetDuration() << " s of camera path.\n";
+	frameTimeReport.Print(std::cout);
+
+	for (const auto& gpuZoneResult : m_renderer->GetGPUProfiler().GetLatestResults())
+	{
+		std::cout << "GPU " << gpuZoneResult.name << ": " << gpuZoneResult.durationMilliseconds << " ms";
+
+		if (gpuZoneResult.pipelineStatistics.has_value())
+		{
+			const GPUProfiler::PipelineStatistics& pipelineStatistics = gpuZoneResult.pipelineStatistics.value();
+
+			std::cout << " (" << pipelineStatistics.inputAssemblyPrimitives << " primitives, " << pipelineStatistics.vertexShaderInvocations << " vertex invocations, "
+				<< pipelineStatistics.clippingPrimitives << " clipped primitives, " << pipelineStatistics.fragmentShaderInvocations << " fragment invocations)";
+		}
+
+		std::cout << "\n";
+	}
+
+	if (m_config.benchmarkFilepath.has_value())
+	{
+		frameTimeReport.WriteJSON(m_config.benchmarkFilepath.value(), m_config.cameraPathFilepath.value_or("standard_route"));
+		std::cout << "Wrote frame time report to " << m_config.benchmarkFilepath.value() << ".\n";
+	}
+
+	if (m_config.frameStatisticsFilepath.has_value())
+	{
+		m_renderer->GetFrameStatistics().Export(m_config.frameStatisticsFilepath.value());
+		std::cout << "Wrote frame statistics to " << m_config.frameStatisticsFilepath.value() << ".\n";
+	}
+
+	if (m_config.memoryReportFilepath.has_value())
+	{
+		MemoryTracker::Get().Print(std::cout);
+		m_renderer->GetVulkanContext().PrintMemoryBudgets(std::cout);
+
+		m_renderer->GetVulkanContext().WriteAllocatorStatistics(m_config.memoryReportFilepath.value());
+		std::cout << "Wrote allocator statistics to " << m_config.memoryReportFilepath.value() << ".\n";
+	}
+
+	if (m_config.captureFilepath.has_value() && frameCount > 0)
+	{
+		m_renderer->CaptureFrame(m_config.captureFilepath.value());
+		std::cout << "Captured final frame to " << m_config.captureFilepath.value() << ".\n";
+	}
+}
+
+void HeadlessTerrainGenerator::Initialise()
+{
+	PROFILE_THREAD_NAME("Main");
+
+	m_cameraPath = m_config.cameraPathFilepath.has_value() ? CameraPath(m_config.cameraPathFilepath.value()) : CameraPath::CreateStandardRoute();
+
+	m_renderer = std::make_unique<Renderer>(VkExtent2D{ m_config.size.x, m_config.size.y });
+	m_world = std::make_unique<World>(*m_renderer, m_config.size, m_config.worldConfig);
+
+	m_world->WaitForPipelines();
+}
+
+void HeadlessTerrainGenerator::Destroy() noexcept
+{
+	if (m_renderer != nullptr)
+	{
+		m_renderer->FinaliseRenderOperations();
+	}
+
+	m_world = nullptr;
+	m_renderer = nullptr;
+}
+
+void HeadlessTerrainGenerator::Render()
+{
+	PROFILE_SCOPE("HeadlessTerrainGenerator::Render");
+
+	if (m_renderer->PrepareRender())
+	{
+		{
+			PROFILE_GPU_SCOPE(*m_renderer, "Terrain pass");
+
+			m_renderer->BeginRender(World::GetSkyClearColour(), VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+			{
+				m_world->Render();
+			}
+			m_renderer->EndRender();
+		}
+
+		m_renderer->Present();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#define GLM_FORCE_RADIANS
+#define GLM_FORCE_DEPTH_ZERO_TO_ONE
+#include <glm/glm.hpp>
+
+#include "../engine/graphics/renderer/Renderer.h"
+#include "CameraPath.h"
+#include "World.h"
+
+class HeadlessTerrainGenerator
+{
+public:
+	struct Config
+	{
+		glm::uvec2 size{ 1920u, 1080u };
+		std::optional<std::uint32_t> frameCount = std::nullopt;
+		float timestep = 1.0f / 60.0f;
+		World::Config worldConfig{ };
+
+		std::optional<std::string> cameraPathFilepath = std::nullopt;
+		std::optional<std::string> benchmarkFilepath = std::nullopt;
+		std::optional<std::string> captureFilepath = std::nullopt;
+		std::optional<std::string> frameStatisticsFilepath = std::nullopt;
+		std::optional<std::string> memoryReportFilepath = std::nullopt;
+	};
+
+private:
+	Config m_config;
+	CameraPath m_cameraPath;
+
+	std::unique_ptr<Renderer> m_renderer = nullptr;
+	std::unique_ptr<World> m_world = nullptr;
+
+public:
+	HeadlessTerrainGenerator(const Config& config);
+	~HeadlessTerrainGenerator() noexcept;
+
+	void Run();
+
+private:
+	void Initialise();
+	void Destroy() noexcept;
+
+	void Render();
+};
\ No newline at end of file
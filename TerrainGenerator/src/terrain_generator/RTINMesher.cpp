@@ -0,0 +1,105 @@
+#include "RTINMesher.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+RTINMesher::RTINMesher(const std::size_t gridSize)
+	: m_gridSize(gridSize)
+{
+	const std::size_t tileSize = m_gridSize - 1;
+
+	if (tileSize == 0 || (tileSize & (tileSize - 1)) != 0)
+	{
+		throw std::invalid_argument("RTIN grid size must be a power of two plus one.");
+	}
+
+	m_triangleCount = tileSize * tileSize * 2 - 2;
+	m_parentTriangleCount = m_triangleCount - tileSize * tileSize;
+	m_triangleCoordinates.resize(m_triangleCount);
+
+	const int maxCoordinate = static_cast<int>(tileSize);
+
+	for (std::size_t i = 0; i < m_triangleCount; ++i)
+	{
+		std::size_t triangleID = i + 2;
+
+		glm::ivec2 a{ 0, 0 };
+		glm::ivec2 b{ 0, 0 };
+		glm::ivec2 c{ 0, 0 };
+
+		if (triangleID & 1)
+		{
+			b = glm::ivec2{ maxCoordinate, maxCoordinate };
+			c = glm::ivec2{ maxCoordinate, 0 };
+		}
+		else
+		{
+			a = glm::ivec2{ maxCoordinate, maxCoordinate };
+			c = glm::ivec2{ 0, maxCoordinate };
+		}
+
+		while ((triangleID >>= 1) > 1)
+		{
+			const glm::ivec2 midpoint = (a + b) / 2;
+
+			if (triangleID & 1)
+			{
+				b = a;
+				a = c;
+			}
+			else
+			{
+				a = b;
+				b = c;
+			}
+
+			c = midpoint;
+		}
+
+		m_triangleCoordinates[i] = glm::ivec4{ a.x, a.y, b.x, b.y };
+	}
+}
+
+[[nodiscard]] RTINMesher::Mesh RTINMesher::CreateMesh(const std::vector<float>& errorMap, const float maxError) const
+{
+	Mesh mesh{ };
+	std::vector<std::uint32_t> vertexIndices(m_gridSize * m_gridSize, 0u);
+
+	const int maxCoordinate = static_cast<int>(m_gridSize - 1);
+
+	ProcessTriangle(errorMap, maxError, glm::ivec2{ 0, 0 }, glm::ivec2{ maxCoordinate, maxCoordinate }, glm::ivec2{ maxCoordinate, 0 }, vertexIndices, mesh);
+	ProcessTriangle(errorMap, maxError, glm::ivec2{ maxCoordinate, maxCoordinate }, glm::ivec2{ 0, 0 }, glm::ivec2{ 0, maxCoordinate }, vertexIndices, mesh);
+
+	return mesh;
+}
+
+void RTINMesher::ProcessTriangle(const std::vector<float>& errorMap, const float maxError, const glm::ivec2& a, const glm::ivec2& b, const glm::ivec2& c, std::vector<std::uint32_t>& vertexIndices, Mesh& mesh) const
+{
+	const glm::ivec2 midpoint = (a + b) / 2;
+	const bool canSplit = glm::abs(a.x - c.x) + glm::abs(a.y - c.y) > 1;
+
+	if (canSplit && errorMap[midpoint.y * m_gridSize + midpoint.x] > maxError)
+	{
+		ProcessTriangle(errorMap, maxError, c, a, midpoint, vertexIndices, mesh);
+		ProcessTriangle(errorMap, maxError, b, c, midpoint, vertexIndices, mesh);
+	}
+	else
+	{
+		mesh.triangles.push_back(GetVertexIndex(a, vertexIndices, mesh));
+		mesh.triangles.push_back(GetVertexIndex(b, vertexIndices, mesh));
+		mesh.triangles.push_back(GetVertexIndex(c, vertexIndices, mesh));
+	}
+}
+
+std::uint32_t RTINMesher::GetVertexIndex(const glm::ivec2& vertex, std::vector<std::uint32_t>& vertexIndices, Mesh& mesh) const
+{
+	std::uint32_t& vertexIndex = vertexIndices[vertex.y * m_gridSize + vertex.x];
+
+	if (vertexIndex == 0)
+	{
+		mesh.vertices.emplace_back(vertex.x, vertex.y);
+		vertexIndex = static_cast<std::uint32_t>(mesh.vertices.size());
+	}
+
+	return vertexIndex - 1;
+}
\ No newline at end of file
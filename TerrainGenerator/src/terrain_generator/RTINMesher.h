@@ -0,0 +1,78 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+class RTINMesher
+{
+public:
+	struct Mesh
+	{
+		std::vector<glm::uvec2> vertices;
+		std::vector<std::uint32_t> triangles;
+	};
+
+private:
+	std::size_t m_gridSize;
+	std::size_t m_triangleCount;
+	std::size_t m_parentTriangleCount;
+
+	std::vector<glm::ivec4> m_triangleCoordinates;
+
+public:
+	explicit RTINMesher(const std::size_t gridSize);
+	~RTINMesher() noexcept = default;
+
+	template <typename HeightMap>
+	[[nodiscard]] std::vector<float> CreateErrorMap(const HeightMap& heightMap) const
+	{
+		if (heightMap.size() != m_gridSize || heightMap.front().size() != m_gridSize)
+		{
+			throw std::invalid_argument("Height map does not match the RTIN grid size.");
+		}
+
+		std::vector<float> errorMap(m_gridSize * m_gridSize, 0.0f);
+
+		for (std::size_t i = m_triangleCount; i-- > 0;)
+		{
+			const glm::ivec2 a{ m_triangleCoordinates[i].x, m_triangleCoordinates[i].y };
+			const glm::ivec2 b{ m_triangleCoordinates[i].z, m_triangleCoordinates[i].w };
+
+			const glm::ivec2 midpoint = (a + b) / 2;
+			const glm::ivec2 c{ midpoint.x + midpoint.y - a.y, midpoint.y + a.x - midpoint.x };
+
+			const float interpolatedHeight = (heightMap[a.x][a.y] + heightMap[b.x][b.y]) / 2.0f;
+			const std::size_t midpointIndex = midpoint.y * m_gridSize + midpoint.x;
+			const float midpointError = glm::abs(interpolatedHeight - heightMap[midpoint.x][midpoint.y]);
+
+			errorMap[midpointIndex] = std::max(errorMap[midpointIndex], midpointError);
+
+			if (i < m_parentTriangleCount)
+			{
+				const glm::ivec2 leftChild = (a + c) / 2;
+				const glm::ivec2 rightChild = (b + c) / 2;
+
+				errorMap[midpointIndex] = std::max({
+					errorMap[midpointIndex],
+					errorMap[leftChild.y * m_gridSize + leftChild.x],
+					errorMap[rightChild.y * m_gridSize + rightChild.x]
+				});
+			}
+		}
+
+		return errorMap;
+	}
+
+	[[nodiscard]] Mesh CreateMesh(const std::vector<float>& errorMap, const float maxError) const;
+
+	inline std::size_t GetGridSize() const noexcept { return m_gridSize; }
+
+private:
+	void ProcessTriangle(const std::vector<float>& errorMap, const float maxError, const glm::ivec2& a, const glm::ivec2& b, const glm::ivec2& c, std::vector<std::uint32_t>& vertexIndices, Mesh& mesh) const;
+	std::uint32_t GetVertexIndex(const glm::ivec2& vertex, std::vector<std::uint32_t>& vertexIndices, Mesh& mesh) const;
+};
\ No newline at end of file
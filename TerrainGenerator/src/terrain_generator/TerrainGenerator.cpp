@@ -1,6 +1,13 @@
 #include "TerrainGenerator.h"
 
-TerrainGenerator::TerrainGenerator()
+#include <exception>
+#include <iostream>
+
+#include "../engine/utility/MemoryTracker.h"
+#include "../engine/utility/Profiler.h"
+
+TerrainGenerator::TerrainGenerator(const std::optional<std::string>& cameraRecordingFilepath)
+	: m_cameraRecordingFilepath(cameraRecordingFilepath)
 {
 	Initialise();
 }
@@ -14,6 +21,8 @@ void TerrainGenerator::Run()
 {
 	while (m_isRunning)
 	{
+		PROFILE_SCOPE("TerrainGenerator::Frame");
+
 		PollEvents();
 
 		if (!m_isPaused)
@@ -32,7 +41,9 @@ void TerrainGenerator::Initialise()
 		throw std::runtime_error("Failed to initialise SDL.");
 	}
 
-	m_window.Create("Terrain Generator", s_InitialWindowSize);
+	PROFILE_THREAD_NAME("Main");
+
+	m_window.Create(s_WindowTitle, s_InitialWindowSize);
 	m_renderer = std::make_unique<Renderer>(m_window);
 
 	if (SDL_CaptureMouse(SDL_TRUE) != 0)
@@ -47,12 +58,36 @@ void TerrainGenerator::Initialise()
 
 	SDL_GetRelativeMouseState(nullptr, nullptr);
 
-	m_world = std::make_unique<World>(*m_renderer, m_window);
+	m_world = std::make_unique<World>(*m_renderer, m_window.GetDrawableSize(), World::Config{ });
 }
 
 void TerrainGenerator::Destroy() noexcept
 {
 	m_renderer->FinaliseRenderOperations();
+
+#ifdef ENABLE_PROFILER
+	try
+	{
+		PROFILE_WRITE_TRACE(Profiler::GetDefaultTraceFilepath());
+	}
+	catch (const std::exception& error)
+	{
+		std::cerr << error.what() << "\n";
+	}
+#endif
+
+	if (m_cameraRecordingFilepath.has_value())
+	{
+		try
+		{
+			m_cameraRecording.Save(m_cameraRecordingFilepath.value());
+			std::cout << "Saved camera recording to " << m_cameraRecordingFilepath.value() << ".\n";
+		}
+		catch (const std::exception& error)
+		{
+			std::cerr << error.what() << "\n";
+		}
+	}
 	
 	m_world = nullptr;
 	m_renderer = nullptr;
@@ -63,6 +98,8 @@ void TerrainGenerator::Destroy() noexcept
 
 void TerrainGenerator::PollEvents()
 {
+	PROFILE_SCOPE("TerrainGenerator::PollEvents");
+
 	SDL_Event event{ };
 
 	while (SDL_PollEvent(&event))
@@ -72,6 +109,37 @@ void TerrainGenerator::PollEvents()
 		case SDL_KEYDOWN:
 			switch (event.key.keysym.sym)
 			{
+			case SDLK_F3:
+				m_world->ToggleWireframe();
+
+				break;
+
+			case SDLK_F6:
+				PROFILE_WRITE_TRACE(Profiler::GetDefaultTraceFilepath());
+
+				break;
+
+			case SDLK_F7:
+				ExportFrameStatistics();
+
+				break;
+
+			case SDLK_F8:
+				m_showFrameStatistics = !m_showFrameStatistics;
+				m_frameStatisticsTitleTicks = 0;
+
+				if (!m_showFrameStatistics)
+				{
+					m_window.SetTitle(s_WindowTitle);
+				}
+
+				break;
+
+			case SDLK_F9:
+				ReportMemoryUsage();
+
+				break;
+
 			case SDLK_F11:
 				m_window.ToggleFullscreen();
 
@@ -98,7 +166,7 @@ void TerrainGenerator::PollEvents()
 
 			case SDL_WINDOWEVENT_MINIMIZED:
 				m_renderer->ProcessWindowResize();
-				m_world->ProcessWindowResize(m_window);
+				m_world->ProcessWindowResize(m_window.GetDrawableSize());
 
 				break;
 
@@ -131,30 +199,85 @@ void TerrainGenerator::PollEvents()
 
 void TerrainGenerator::ProcessInput()
 {
-	m_world->ProcessInput();
+	PROFILE_SCOPE("TerrainGenerator::ProcessInput");
+
+	m_currentInput = Camera3D::SampleInput();
+	m_world->ProcessInput(m_currentInput);
 }
 
 void TerrainGenerator::Update()
 {
+	PROFILE_SCOPE("TerrainGenerator::Update");
+
 	const float deltaTime = CalculateDeltaTime();
 
+	if (m_cameraRecordingFilepath.has_value())
+	{
+		m_cameraRecording.AddInputFrame(CameraPath::InputFrame{ deltaTime, m_currentInput });
+	}
+
 	m_world->Update(deltaTime);
 }
 
 void TerrainGenerator::Render()
 {
+	PROFILE_SCOPE("TerrainGenerator::Render");
+
 	if (m_renderer->PrepareRender())
 	{
-		constexpr glm::vec4 SkyClearColour{ 0.1f, 0.5f, 1.0f, 1.0f };
-
-		m_renderer->BeginRender(SkyClearColour);
 		{
-			m_world->Render();
+			PROFILE_GPU_SCOPE(*m_renderer, "Terrain pass");
+
+			m_renderer->BeginRender(World::GetSkyClearColour(), VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+			{
+				m_world->Render();
+			}
+			m_renderer->EndRender();
 		}
-		m_renderer->EndRender();
 
 		m_renderer->Present();
+		UpdateWindowTitle();
+	}
+}
+
+void TerrainGenerator::ExportFrameStatistics() const
+{
+	try
+	{
+		m_renderer->GetFrameStatistics().Export(s_FrameStatisticsCSVFilepath);
+		m_renderer->GetFrameStatistics().Export(s_FrameStatisticsJSONFilepath);
 	}
+	catch (const std::exception& error)
+	{
+		std::cerr << error.what() << "\n";
+	}
+}
+
+void TerrainGenerator::ReportMemoryUsage() const
+{
+	MemoryTracker::Get().Print(std::cout);
+	m_renderer->GetVulkanContext().PrintMemoryBudgets(std::cout);
+
+	try
+	{
+		m_renderer->GetVulkanContext().WriteAllocatorStatistics(s_AllocatorStatisticsFilepath);
+		std::cout << "Wrote allocator statistics to " << s_AllocatorStatisticsFilepath << ".\n";
+	}
+	catch (const std::exception& error)
+	{
+		std::cerr << error.what() << "\n";
+	}
+}
+
+void TerrainGenerator::UpdateWindowTitle()
+{
+	if (!m_showFrameStatistics || SDL_GetTicks() - m_frameStatisticsTitleTicks < s_FrameStatisticsTitleInterval)
+	{
+		return;
+	}
+
+	m_frameStatisticsTitleTicks = SDL_GetTicks();
+	m_window.SetTitle(std::string{ s_WindowTitle } + " | " + m_renderer->GetFrameStatistics().GetSummary());
 }
 
 float TerrainGenerator::CalculateDeltaTime()
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string>
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
@@ -8,13 +10,21 @@
 
 #include "../engine/window/Window.h"
 #include "../engine/graphics/renderer/Renderer.h"
+#include "Camera3D.h"
+#include "CameraPath.h"
 #include "World.h"
 
 class TerrainGenerator
 {
 private:
+	static constexpr const char* s_WindowTitle = "Terrain Generator";
 	static constexpr glm::uvec2 s_InitialWindowSize{ 1920u, 1080u };
 
+	static constexpr const char* s_FrameStatisticsCSVFilepath = "frame_statistics.csv";
+	static constexpr const char* s_FrameStatisticsJSONFilepath = "frame_statistics.json";
+	static constexpr Uint32 s_FrameStatisticsTitleInterval = 500u;
+	static constexpr const char* s_AllocatorStatisticsFilepath = "allocator_statistics.json";
+
 	Window m_window;
 	std::unique_ptr<Renderer> m_renderer = nullptr;
 
@@ -22,10 +32,17 @@ private:
 	bool m_isPaused = false;
 	Uint32 m_ticksCount = 0;
 
+	bool m_showFrameStatistics = false;
+	Uint32 m_frameStatisticsTitleTicks = 0;
+
 	std::unique_ptr<World> m_world = nullptr;
 
+	Camera3D::InputState m_currentInput{ };
+	std::optional<std::string> m_cameraRecordingFilepath;
+	CameraPath m_cameraRecording;
+
 public:
-	TerrainGenerator();
+	explicit TerrainGenerator(const std::optional<std::string>& cameraRecordingFilepath = std::nullopt);
 	~TerrainGenerator() noexcept;
 
 	void Run();
@@ -39,5 +56,9 @@ private:
 	void Update();
 	void Render();
 
+	void ExportFrameStatistics() const;
+	void ReportMemoryUsage() const;
+	void UpdateWindowTitle();
+
 	float CalculateDeltaTime();
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+#include "Water.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "../engine/graphics/renderer/Renderer.h"
+#include "../engine/graphics/Vertex.h"
+#include "Chunk.h"
+
+Water::Water(const Renderer& renderer, const float halfExtent, const VkPrimitiveTopology topology)
+	: m_vertexBuffer(renderer), m_indexBuffer(renderer), m_halfExtent(halfExtent), m_topology(topology)
+{
+	InitialiseVertices();
+}
+
+Water::~Water() noexcept
+{ }
+
+void Water::Update(const glm::ivec2& centreChunk)
+{
+	const glm::vec3 centre{
+		(centreChunk.x + 0.5f) * Chunk::GetChunkLength(),
+		Chunk::GetWaterLevel(),
+		(centreChunk.y + 0.5f) * Chunk::GetChunkWidth()
+	};
+
+	m_model = glm::translate(glm::mat4{ 1.0f }, centre);
+}
+
+void Water::Render(class Renderer& renderer, const GraphicsPipeline& pipeline)
+{
+	renderer.PushConstants(pipeline, m_model);
+
+	renderer.BindVertexBuffer(m_vertexBuffer);
+	renderer.BindIndexBuffer(m_indexBuffer);
+
+	renderer.DrawIndexed(m_indexBuffer.GetIndexCount());
+	renderer.RecordStatistic(FrameStatistics::Statistic::TrianglesSubmitted, m_triangleCount);
+}
+
+void Water::InitialiseVertices()
+{
+	constexpr glm::vec3 Normal{ 0.0f, 1.0f, 0.0f };
+
+	const std::vector<VertexP3C3N3> vertices{
+		{ glm::vec3{ -m_halfExtent, 0.0f, -m_halfExtent }, s_Colour, Normal },
+		{ glm::vec3{ m_halfExtent, 0.0f, -m_halfExtent }, s_Colour, Normal },
+		{ glm::vec3{ -m_halfExtent, 0.0f, m_halfExtent }, s_Colour, Normal },
+		{ glm::vec3{ m_halfExtent, 0.0f, m_halfExtent }, s_Colour, Normal }
+	};
+
+	const std::vector<std::uint16_t> indices = m_topology == VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP
+		? std::vector<std::uint16_t>{ 0, 1, 2, 3 }
+		: std::vector<std::uint16_t>{ 0, 1, 2, 2, 1, 3 };
+
+	m_vertexBuffer.Initialise(vertices);
+	m_indexBuffer.Initialise(indices);
+
+	m_triangleCount = FrameStatistics::GetTriangleCount(m_topology, indices);
+}
\ No newline at end of file
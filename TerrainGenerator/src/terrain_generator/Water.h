@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <vulkan/vulkan.h>
+
+#include "../engine/graphics/buffers/IndexBuffer.h"
+#include "../engine/graphics/buffers/VertexBuffer.h"
+#include "../engine/graphics/pipeline/GraphicsPipeline.h"
+
+class Water
+{
+private:
+	static constexpr glm::vec3 s_Colour{ 0.0f, 0.5f, 1.0f };
+
+	VertexBuffer m_vertexBuffer;
+	IndexBuffer m_indexBuffer;
+
+	float m_halfExtent;
+	VkPrimitiveTopology m_topology;
+	std::uint64_t m_triangleCount = 0u;
+	glm::mat4 m_model{ 1.0f };
+
+public:
+	Water(const class Renderer& renderer, const float halfExtent, const VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+	~Water() noexcept;
+
+	void Update(const glm::ivec2& centreChunk);
+	void Render(class Renderer& renderer, const GraphicsPipeline& pipeline);
+
+	inline float GetHalfExtent() const noexcept { return m_halfExtent; }
+
+private:
+	void InitialiseVertices();
+};
\ No newline at end of file
@@ -1,111 +1,404 @@
 #include "World.h"
 
+#include <algorithm>
 #include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <unordered_set>
+#include <utility>
 
 #define GLM_FORCE_RADIANS
 #define GLM_FORCE_DEPTH_ZERO_TO_ONE
 #include <glm/gtc/matrix_transform.hpp>
 
-World::World(Renderer& renderer, const Window& window)
-	: m_renderer(renderer)
+#include "../engine/utility/MemoryTracker.h"
+#include "../engine/utility/Profiler.h"
+
+World::World(Renderer& renderer, const glm::uvec2& drawableSize, const Config& config)
+	: m_renderer(renderer), m_config(config), m_pipelineRegistry(renderer), m_chunkOriginTable(renderer), m_chunkBufferDefragmenter(renderer), m_water(renderer, (s_MaxRenderDistance + 1.0f) * Chunk::GetChunkLength(), Chunk::GetPrimitiveTopology(s_ChunkMeshType))
 {
-	Initialise(window);
+	Initialise(drawableSize);
+	UpdateChunks(m_previousChunk);
 
-	for (int i = -s_RenderDistance; i <= s_RenderDistance; ++i)
+	while (m_renderDistance < s_MaxRenderDistance && CanExpandRenderDistance())
 	{
-		for (int j = -s_RenderDistance; j <= s_RenderDistance; ++j)
-		{
-			m_chunks.emplace_back(std::make_unique<Chunk>(m_renderer, glm::ivec2{ i, j }));
-		}
+		++m_renderDistance;
+		UpdateChunks(m_previousChunk);
 	}
+
+	m_renderer.GetFrameStatistics().Set(FrameStatistics::Statistic::RenderDistance, static_cast<std::uint64_t>(m_renderDistance));
 }
 
 World::~World() noexcept
 {
+	m_chunkBufferDefragmenter.Finish();
 	m_chunks.clear();
-	m_terrainPipeline->Destroy();
+	m_terrainPipelines = { };
+	m_pipelineRegistry.Destroy();
 }
 
-void World::ProcessInput()
+void World::ProcessInput(const Camera3D::InputState& input)
 {
-	m_camera.ProcessInput();
+	m_camera.ApplyInput(input);
 }
 
 void World::Update(const float deltaTime)
 {
+	PROFILE_SCOPE("World::Update");
+
 	m_camera.Update(deltaTime);
 
-	static glm::ivec2 previousChunk{ 0, 0 };
 	const glm::ivec2 currentChunk = glm::ivec2{ glm::round(m_camera.GetPosition().x / Chunk::GetChunkLength()), glm::round(m_camera.GetPosition().z / Chunk::GetChunkWidth()) };
 
-	if (currentChunk != previousChunk)
+	// Chunk buffers cannot be allocated or freed while a defragmentation pass holds their memory blocks.
+	if (!m_chunkBufferDefragmenter.IsPassInProgress())
 	{
-		for (auto& chunk : m_chunks)
+		const bool hasRenderDistanceChanged = UpdateRenderDistance(deltaTime);
+
+		if (currentChunk != m_previousChunk || hasRenderDistanceChanged)
 		{
-			const float xDistanceFromCamera = chunk->GetPosition().x - (m_camera.GetPosition().x / Chunk::GetChunkLength());
-			const float zDistanceFromCamera = chunk->GetPosition().y - (m_camera.GetPosition().z / Chunk::GetChunkWidth());
+			m_renderer.InvalidateSecondaryCommandBuffers();
+			UpdateChunks(currentChunk);
+			m_chunkBufferDefragmenter.Postpone();
+		}
 
-			if (xDistanceFromCamera > s_RenderDistance)
-			{
-				chunk = std::make_unique<Chunk>(m_renderer, glm::ivec2{ chunk->GetPosition().x - (s_RenderDistance * 2.0f), chunk->GetPosition().y });
-			}
-			else if (xDistanceFromCamera < -s_RenderDistance)
-			{
-				chunk = std::make_unique<Chunk>(m_renderer, glm::ivec2{ chunk->GetPosition().x + (s_RenderDistance * 2.0f), chunk->GetPosition().y });
-			}
+		m_previousChunk = currentChunk;
+	}
 
-			else if (zDistanceFromCamera > s_RenderDistance)
-			{
-				chunk = std::make_unique<Chunk>(m_renderer, glm::ivec2{ chunk->GetPosition().x, chunk->GetPosition().y - (s_RenderDistance * 2.0f) });
-			}
-			else if (zDistanceFromCamera < -s_RenderDistance)
-			{
-				chunk = std::make_unique<Chunk>(m_renderer, glm::ivec2{ chunk->GetPosition().x, chunk->GetPosition().y + (s_RenderDistance * 2.0f) });
-			}
-		}
+	if (const std::optional<BufferDefragmenter::PassResult> defragmentationResult = m_chunkBufferDefragmenter.Update([this]() { return GetChunkBuffers(); });
+		defragmentationResult.has_value())
+	{
+		BufferDefragmenter::Print(std::cout, defragmentationResult.value());
 	}
 
-	previousChunk = currentChunk;
+	m_water.Update(currentChunk);
 }
 
 void World::Render()
 {
-	m_renderer.BindPipeline(*m_terrainPipeline);
+	PROFILE_SCOPE("World::Render");
 
-	const std::array<glm::mat4, 2> viewProjection{ m_camera.GetViewMatrix(), m_projection };
-	m_terrainPipeline->SetUniform(0, viewProjection);
-	m_renderer.BindDescriptorSet(*m_terrainPipeline);
+	GraphicsPipeline* const terrainPipelineLocation = m_terrainPipelines[static_cast<std::size_t>(m_drawWireframe)].TryGet();
 
-	for (const auto& chunk : m_chunks)
+	if (terrainPipelineLocation == nullptr)
 	{
-		chunk->Render(m_renderer, *m_terrainPipeline);
+		return;
 	}
+
+	GraphicsPipeline& terrainPipeline = *terrainPipelineLocation;
+
+	const std::array<glm::mat4, 2> viewProjection{ m_camera.GetViewMatrix(), m_projection };
+	terrainPipeline.SetUniform(0, viewProjection);
+	terrainPipeline.SetStorageBuffer(s_ChunkOriginSet, 0, 0, m_chunkOriginTable.GetHandle());
+
+	const Frustum viewFrustum(m_projection * m_camera.GetViewMatrix());
+	const glm::vec3 cameraPosition = m_camera.GetPosition();
+
+	const std::uint32_t taskCount = static_cast<std::uint32_t>(std::clamp<std::size_t>(m_chunks.size(), 1u, m_renderer.GetSecondaryCommandBufferCount()));
+
+	const auto UpdateChunkDrawCommands = [this, taskCount, &viewFrustum, &cameraPosition](const std::uint32_t taskIndex) -> bool
+	{
+		const std::size_t firstChunkIndex = m_chunks.size() * taskIndex / taskCount;
+		const std::size_t lastChunkIndex = m_chunks.size() * (taskIndex + 1) / taskCount;
+
+		bool hasVisibilityChanged = false;
+
+		for (std::size_t i = firstChunkIndex; i < lastChunkIndex; ++i)
+		{
+			if (m_chunks[i]->UpdateDrawCommands(m_renderer, viewFrustum, cameraPosition))
+			{
+				hasVisibilityChanged = true;
+			}
+		}
+
+		return hasVisibilityChanged;
+	};
+
+	m_renderer.ExecuteSecondaryCommandBuffers(taskCount, UpdateChunkDrawCommands, [this, taskCount, &terrainPipeline](const std::uint32_t taskIndex)
+	{
+		m_renderer.BindPipeline(terrainPipeline);
+		m_renderer.BindDescriptorSet(terrainPipeline);
+		m_renderer.PushConstants(terrainPipeline, glm::mat4{ 1.0f });
+
+		const std::size_t firstChunkIndex = m_chunks.size() * taskIndex / taskCount;
+		const std::size_t lastChunkIndex = m_chunks.size() * (taskIndex + 1) / taskCount;
+
+		for (std::size_t i = firstChunkIndex; i < lastChunkIndex; ++i)
+		{
+			m_chunks[i]->Render(m_renderer, terrainPipeline);
+		}
+
+		if (taskIndex == taskCount - 1)
+		{
+			m_water.Render(m_renderer, terrainPipeline);
+		}
+	});
+}
+
+void World::ProcessWindowResize(const glm::uvec2& drawableSize)
+{
+	m_projection = glm::perspectiveLH(glm::radians(60.0f), static_cast<float>(drawableSize.x) / static_cast<float>(drawableSize.y), 0.1f, 2500.0f);
+	m_projection[1][1] *= -1.0f;
+}
+
+void World::ToggleWireframe() noexcept
+{
+	m_drawWireframe = !m_drawWireframe;
+	m_renderer.InvalidateSecondaryCommandBuffers();
 }
 
-void World::ProcessWindowResize(const Window& window)
+void World::WaitForPipelines() const
 {
-	m_terrainPipeline->RefreshUniformBuffers();
+	m_pipelineRegistry.WaitForAll();
+}
+
+void World::Initialise(const glm::uvec2& drawableSize)
+{
+	if (std::filesystem::exists(s_ShaderArchiveFilepath))
+	{
+		try
+		{
+			m_shaderArchive = std::make_unique<ShaderArchive>(s_ShaderArchiveFilepath);
+		}
+		catch (const std::exception& error)
+		{
+			std::cerr << error.what() << " Falling back to loose shader files.\n";
+		}
+	}
+
+	m_terrainPipelines = { m_pipelineRegistry.Request(GetTerrainPipelineConfig(false)), m_pipelineRegistry.Request(GetTerrainPipelineConfig(true)) };
 
-	m_projection = glm::perspectiveLH(glm::radians(60.0f), static_cast<float>(window.GetDrawableSize().x) / static_cast<float>(window.GetDrawableSize().y), 0.1f, 2500.0f);
+	// Slot zero is left as a zero origin for draws that supply their own model matrix.
+	// Retired chunks hold their slots until the frames drawing them have finished, so the table has room for two full grids.
+	m_chunkOriginTable.Initialise(std::vector<glm::vec4>(s_ChunkOriginSlotCount + 1u, glm::vec4{ 0.0f }));
+	m_freeChunkOriginSlots->reserve(s_ChunkOriginSlotCount);
+
+	for (std::uint32_t slot = s_ChunkOriginSlotCount; slot > 0u; --slot)
+	{
+		m_freeChunkOriginSlots->push_back(slot);
+	}
+
+	m_projection = glm::perspectiveLH(glm::radians(60.0f), static_cast<float>(drawableSize.x) / static_cast<float>(drawableSize.y), 0.1f, 2500.0f);
 	m_projection[1][1] *= -1.0f;
 }
 
-void World::Initialise(const Window& window)
+[[nodiscard]] GraphicsPipeline::Config World::GetTerrainPipelineConfig(const bool drawWireframe) const
 {
-	const GraphicsPipeline::Config terrainPipelineConfig{
+	return GraphicsPipeline::Config{
 		.shaderInfo{
 			{ "assets/shaders/terrain.vert.spv", ShaderModule::Stage::Vertex },
 			{ "assets/shaders/terrain.frag.spv", ShaderModule::Stage::Fragment }
 		},
+		.shaderArchive = m_shaderArchive.get(),
+		.specialisationConstants{
+			{
+				ShaderModule::Stage::Fragment, {
+					{ "c_lightPositionX", std::bit_cast<std::uint32_t>(s_LightPosition.x) },
+					{ "c_lightPositionY", std::bit_cast<std::uint32_t>(s_LightPosition.y) },
+					{ "c_lightPositionZ", std::bit_cast<std::uint32_t>(s_LightPosition.z) },
+					{ "c_lightColourR", std::bit_cast<std::uint32_t>(s_LightColour.r) },
+					{ "c_lightColourG", std::bit_cast<std::uint32_t>(s_LightColour.g) },
+					{ "c_lightColourB", std::bit_cast<std::uint32_t>(s_LightColour.b) },
+					{ "c_ambientStrength", std::bit_cast<std::uint32_t>(s_AmbientStrength) }
+				}
+			}
+		},
 
+		.topology = Chunk::GetPrimitiveTopology(s_ChunkMeshType),
+		.enablePrimitiveRestart = s_ChunkMeshType == Chunk::MeshType::GridStrip,
 		.enableDepthTest = true,
-		.drawWireframe = false,
-		.enableCullFace = true,
+		.drawWireframe = drawWireframe,
+		.enableCullFace = !drawWireframe,
 		.enableBlending = true
 	};
+}
+
+[[nodiscard]] std::uint64_t World::GetChunkKey(const glm::ivec2& position) noexcept
+{
+	return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(position.x)) << 32u) | static_cast<std::uint32_t>(position.y);
+}
 
-	m_terrainPipeline = std::make_unique<GraphicsPipeline>(m_renderer, terrainPipelineConfig);
+bool World::UpdateRenderDistance(const float deltaTime)
+{
+	m_renderDistanceUpdateTimer += deltaTime;
 
-	m_projection = glm::perspectiveLH(glm::radians(60.0f), static_cast<float>(window.GetDrawableSize().x) / static_cast<float>(window.GetDrawableSize().y), 0.1f, 2500.0f);
-	m_projection[1][1] *= -1.0f;
+	if (m_renderDistanceUpdateTimer < s_RenderDistanceUpdateInterval)
+	{
+		return false;
+	}
+
+	m_renderDistanceUpdateTimer = 0.0f;
+
+	const float memoryPressure = GetMemoryPressure();
+	const int previousRenderDistance = m_renderDistance;
+
+	if (memoryPressure > s_HighMemoryPressure && m_renderDistance > s_MinRenderDistance)
+	{
+		--m_renderDistance;
+	}
+	else if (memoryPressure < s_LowMemoryPressure && m_renderDistance < s_MaxRenderDistance && CanExpandRenderDistance())
+	{
+		++m_renderDistance;
+	}
+
+	FrameStatistics& frameStatistics = m_renderer.GetFrameStatistics();
+	frameStatistics.Set(FrameStatistics::Statistic::RenderDistance, static_cast<std::uint64_t>(m_renderDistance));
+	frameStatistics.Set(FrameStatistics::Statistic::MemoryPressure, static_cast<std::uint64_t>(memoryPressure * 100.0f));
+
+	return m_renderDistance != previousRenderDistance;
+}
+
+[[nodiscard]] bool World::CanExpandRenderDistance() const
+{
+	// Growing the square of loaded chunks by one ring adds 8(d + 1) chunks.
+	const std::uint64_t ringChunkCount = 8u * static_cast<std::uint64_t>(m_renderDistance + 1);
+
+	return GetMemoryPressure(ringChunkCount * GetAverageChunkBytes()) < s_HighMemoryPressure;
+}
+
+[[nodiscard]] float World::GetMemoryPressure(const std::uint64_t additionalDeviceBytes) const
+{
+	const VkPhysicalDeviceMemoryProperties& memoryProperties = m_renderer.GetVulkanContext().GetPhysicalDeviceMemoryProperties();
+	const std::vector<VmaBudget> memoryBudgets = m_renderer.GetVulkanContext().GetMemoryBudgets();
+
+	float memoryPressure = static_cast<float>(MemoryTracker::Get().GetTotalUsage(false).currentBytes) / static_cast<float>(m_config.cpuMemoryBudget);
+
+	for (std::size_t i = 0; i < memoryBudgets.size(); ++i)
+	{
+		if (memoryBudgets[i].budget == 0u)
+		{
+			continue;
+		}
+
+		const bool isDeviceLocal = memoryProperties.memoryHeaps[i].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+		const VkDeviceSize projectedUsage = memoryBudgets[i].usage + (isDeviceLocal ? additionalDeviceBytes : 0u);
+
+		memoryPressure = std::max(memoryPressure, static_cast<float>(projectedUsage) / static_cast<float>(memoryBudgets[i].budget));
+	}
+
+	return memoryPressure;
+}
+
+[[nodiscard]] std::uint64_t World::GetAverageChunkBytes() const
+{
+	if (m_chunks.empty())
+	{
+		return 0u;
+	}
+
+	std::uint64_t chunkBytes = 0u;
+
+	for (const auto& chunk : m_chunks)
+	{
+		chunkBytes += chunk->GetDeviceBytes();
+	}
+
+	return chunkBytes / m_chunks.size();
+}
+
+void World::UpdateChunks(const glm::ivec2& centreChunk)
+{
+	PROFILE_SCOPE("World::UpdateChunks");
+
+	std::vector<std::unique_ptr<Chunk>> loadedChunks;
+	loadedChunks.reserve(m_chunks.size());
+
+	std::unordered_set<std::uint64_t> loadedChunkKeys;
+	loadedChunkKeys.reserve(m_chunks.size());
+
+	for (auto& chunk : m_chunks)
+	{
+		const glm::ivec2 offsetFromCentre = glm::abs(chunk->GetPosition() - centreChunk);
+
+		if (offsetFromCentre.x > m_renderDistance || offsetFromCentre.y > m_renderDistance)
+		{
+			RetireChunk(std::move(chunk));
+		}
+		else
+		{
+			loadedChunkKeys.insert(GetChunkKey(chunk->GetPosition()));
+			loadedChunks.push_back(std::move(chunk));
+		}
+	}
+
+	m_chunks = std::move(loadedChunks);
+
+	const bool useChunkOriginTable = m_renderer.GetVulkanContext().SupportsDrawIndirectFirstInstance();
+	std::vector<std::pair<std::uint32_t, glm::vec4>> chunkOriginWrites;
+
+	for (int i = -m_renderDistance; i <= m_renderDistance; ++i)
+	{
+		for (int j = -m_renderDistance; j <= m_renderDistance; ++j)
+		{
+			const glm::ivec2 position = centreChunk + glm::ivec2{ i, j };
+
+			if (!loadedChunkKeys.contains(GetChunkKey(position)))
+			{
+				m_chunks.emplace_back(std::make_unique<Chunk>(m_renderer, position, s_ChunkMeshType));
+				m_renderer.RecordStatistic(FrameStatistics::Statistic::ChunksGenerated);
+
+				if (useChunkOriginTable && !m_freeChunkOriginSlots->empty())
+				{
+					const std::uint32_t chunkOriginSlot = m_freeChunkOriginSlots->back();
+					m_freeChunkOriginSlots->pop_back();
+
+					chunkOriginWrites.emplace_back(chunkOriginSlot, glm::vec4{ position.x * static_cast<int>(Chunk::GetChunkLength()), 0.0f, position.y * static_cast<int>(Chunk::GetChunkWidth()), 0.0f });
+					m_chunks.back()->SetInstanceIndex(chunkOriginSlot);
+				}
+			}
+		}
+	}
+
+	if (chunkOriginWrites.empty())
+	{
+		return;
+	}
+
+	// Slots only return to the free list once no frame in flight reads them, so they are written in the frame without waiting on the GPU.
+	m_renderer.DeferTransferCommands([chunkOriginTable = m_chunkOriginTable.GetHandle(), chunkOriginWrites = std::move(chunkOriginWrites)](VkCommandBuffer commandBuffer)
+	{
+		for (const auto& [slot, origin] : chunkOriginWrites)
+		{
+			vkCmdUpdateBuffer(commandBuffer, chunkOriginTable, static_cast<VkDeviceSize>(slot) * sizeof(glm::vec4), sizeof(glm::vec4), &origin);
+		}
+
+		VkMemoryBarrier memoryBarrier{ };
+		memoryBarrier.sType = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+		memoryBarrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		memoryBarrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+
+		vkCmdPipelineBarrier(commandBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_SHADER_BIT, 0, 1, &memoryBarrier, 0, nullptr, 0, nullptr);
+	});
+}
+
+void World::RetireChunk(std::unique_ptr<Chunk> chunk)
+{
+	m_renderer.DeferDeletion([retiredChunk = std::shared_ptr<Chunk>(std::move(chunk)), freeChunkOriginSlots = m_freeChunkOriginSlots]() mutable
+	{
+		if (retiredChunk->GetInstanceIndex() != 0u)
+		{
+			freeChunkOriginSlots->push_back(retiredChunk->GetInstanceIndex());
+		}
+
+		retiredChunk = nullptr;
+	});
+}
+
+[[nodiscard]] std::vector<Buffer*> World::GetChunkBuffers() const
+{
+	std::vector<Buffer*> chunkBuffers;
+	chunkBuffers.reserve(m_chunks.size() * 2u);
+
+	for (const auto& chunk : m_chunks)
+	{
+		chunkBuffers.push_back(&chunk->GetVertexBuffer());
+		chunkBuffers.push_back(&chunk->GetIndexBuffer());
+	}
+
+	return chunkBuffers;
 }
\ No newline at end of file
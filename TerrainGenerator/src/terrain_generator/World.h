@@ -1,37 +1,97 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
+#include <glm/glm.hpp>
+
+#include "../engine/graphics/buffers/BufferDefragmenter.h"
+#include "../engine/graphics/buffers/StorageBuffer.h"
 #include "../engine/graphics/pipeline/GraphicsPipeline.h"
+#include "../engine/graphics/pipeline/PipelineHandle.h"
+#include "../engine/graphics/pipeline/PipelineRegistry.h"
+#include "../engine/graphics/pipeline/ShaderArchive.h"
 #include "../engine/graphics/renderer/Renderer.h"
-#include "../engine/window/Window.h"
 #include "Camera3D.h"
 #include "Chunk.h"
+#include "Water.h"
 
 class World
 {
+public:
+	struct Config
+	{
+		std::uint64_t cpuMemoryBudget = 512u * 1'024u * 1'024u;
+	};
+
 private:
-	static constexpr int s_RenderDistance = 32u;
+	static constexpr int s_MinRenderDistance = 8;
+	static constexpr int s_MaxRenderDistance = 32;
+	static constexpr float s_RenderDistanceUpdateInterval = 0.5f;
+	static constexpr float s_HighMemoryPressure = 0.9f;
+	static constexpr float s_LowMemoryPressure = 0.75f;
+
+	static constexpr std::uint32_t s_ChunkOriginSet = 1u;
+	static constexpr std::uint32_t s_ChunkOriginSlotCount = 2u * (2u * s_MaxRenderDistance + 1u) * (2u * s_MaxRenderDistance + 1u);
+
+	static constexpr Chunk::MeshType s_ChunkMeshType = Chunk::MeshType::Grid;
+	static constexpr const char* s_ShaderArchiveFilepath = "assets/shaders/shaders.archive";
+
+	static constexpr glm::vec3 s_LightPosition{ 0.0f, 128.0f, 0.0f };
+	static constexpr glm::vec3 s_LightColour{ 1.0f, 1.0f, 1.0f };
+	static constexpr float s_AmbientStrength = 0.3f;
+	static constexpr glm::vec4 s_SkyClearColour{ 0.1f, 0.5f, 1.0f, 1.0f };
 
 	Renderer& m_renderer;
-	std::unique_ptr<GraphicsPipeline> m_terrainPipeline = nullptr;
+	Config m_config;
+	std::unique_ptr<ShaderArchive> m_shaderArchive = nullptr;
+	PipelineRegistry m_pipelineRegistry;
+	std::array<PipelineHandle, 2u> m_terrainPipelines{ };
+	bool m_drawWireframe = false;
 
 	Camera3D m_camera{ glm::vec3{ 0.0f, 80.0f, 0.0f } };
+	glm::ivec2 m_previousChunk{ 0, 0 };
+	int m_renderDistance = s_MinRenderDistance;
+	float m_renderDistanceUpdateTimer = 0.0f;
 	std::vector<std::unique_ptr<Chunk>> m_chunks;
+	StorageBuffer m_chunkOriginTable;
+	std::shared_ptr<std::vector<std::uint32_t>> m_freeChunkOriginSlots = std::make_shared<std::vector<std::uint32_t>>();
+	BufferDefragmenter m_chunkBufferDefragmenter;
+	Water m_water;
 
 	glm::mat4 m_projection{ 1.0f };
 
 public:
-	World(class Renderer& renderer, const Window& window);
+	static constexpr glm::vec4 GetSkyClearColour() noexcept { return s_SkyClearColour; }
+
+	World(class Renderer& renderer, const glm::uvec2& drawableSize, const Config& config);
 	~World() noexcept;
 
-	void ProcessInput();
+	void ProcessInput(const Camera3D::InputState& input);
 	void Update(const float deltaTime);
 	void Render();
 
-	void ProcessWindowResize(const Window& window);
+	void ProcessWindowResize(const glm::uvec2& drawableSize);
+	void ToggleWireframe() noexcept;
+	void WaitForPipelines() const;
+
+	inline Camera3D& GetCamera() noexcept { return m_camera; }
+	inline int GetRenderDistance() const noexcept { return m_renderDistance; }
 
 private:
-	void Initialise(const Window& window);
+	void Initialise(const glm::uvec2& drawableSize);
+	[[nodiscard]] GraphicsPipeline::Config GetTerrainPipelineConfig(const bool drawWireframe) const;
+
+	[[nodiscard]] static std::uint64_t GetChunkKey(const glm::ivec2& position) noexcept;
+
+	bool UpdateRenderDistance(const float deltaTime);
+	[[nodiscard]] bool CanExpandRenderDistance() const;
+	[[nodiscard]] float GetMemoryPressure(const std::uint64_t additionalDeviceBytes = 0u) const;
+	[[nodiscard]] std::uint64_t GetAverageChunkBytes() const;
+
+	void UpdateChunks(const glm::ivec2& centreChunk);
+	void RetireChunk(std::unique_ptr<Chunk> chunk);
+	[[nodiscard]] std::vector<Buffer*> GetChunkBuffers() const;
 };
\ No newline at end of file